@@ -8,6 +8,7 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2025-01-20       CDT             Modify version as Rev1.0.0
+   2026-10-18       CDT             Add hc32_ll_nfc_ftl.h
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -311,6 +312,7 @@ extern "C"
 
 #if (LL_NFC_ENABLE == DDL_ON)
 #include "hc32_ll_nfc.h"
+#include "hc32_ll_nfc_ftl.h"
 #endif /* LL_NFC_ENABLE */
 
 #if (LL_OTS_ENABLE == DDL_ON)
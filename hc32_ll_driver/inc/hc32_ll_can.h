@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add RX ring drained in ISR and acceptance filter planner
+   2026-10-18       CDT             Add TX priority scheduler on STB priority mode and PTB
+   2026-10-18       CDT             Add TTCAN schedule table engine
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -211,6 +214,85 @@ typedef struct {
     uint8_t au8Data[64U];                   /*!< RX data payload. */
 } stc_can_rx_frame_t;
 
+/**
+ * @brief CAN RX ring entry structure.
+ */
+typedef struct {
+    stc_can_rx_frame_t stcFrame;            /*!< Received frame. */
+    uint32_t u32Timestamp;                  /*!< Timestamp taken when the frame is moved out of the receive buffer. */
+} stc_can_rx_entry_t;
+
+/**
+ * @brief CAN RX ring structure.
+ * @note  The ring is filled by CAN_RxRingIrqHandler() and read by CAN_RxRingGet() without disabling
+ *        the interrupts, one writer and one reader only.
+ */
+typedef struct {
+    stc_can_rx_entry_t *pstcEntry;          /*!< Entry buffer of the ring. */
+    uint32_t u32Size;                       /*!< Number of entries in the buffer, a power of 2. */
+    uint32_t (*pfnGetTimestamp)(void);      /*!< Timestamp source, e.g. a free running timer counter. Can be NULL. */
+    __IO uint32_t u32Head;                  /*!< Count of frames written, only changed by the writer. */
+    __IO uint32_t u32Tail;                  /*!< Count of frames read, only changed by the reader. */
+    __IO uint32_t u32Overrun;               /*!< Count of frames dropped because the ring is full. */
+} stc_can_rx_ring_t;
+
+/**
+ * @brief CAN TX scheduler entry structure.
+ */
+typedef struct {
+    stc_can_tx_frame_t stcFrame;            /*!< Frame to be transmitted. */
+    uint32_t u32Key;                        /*!< Arbitration key of the frame, see @ref CAN_TX_SCHED_KEY. */
+    uint32_t u32Seq;                        /*!< Queue order of the frames with the same key. */
+} stc_can_tx_entry_t;
+
+/**
+ * @brief CAN TX scheduler structure.
+ * @note  The members are maintained by the driver, do not modify them after CAN_TxSchedInit().
+ */
+typedef struct {
+    CM_CAN_TypeDef *CANx;                   /*!< CAN unit of the scheduler. */
+    stc_can_tx_entry_t *pstcEntry;          /*!< Entry buffer of the queue. */
+    uint16_t *pu16Index;                    /*!< Entry index array, the queued entries in heap order first,
+                                                 then the free entries. */
+    uint16_t u16Size;                       /*!< Number of entries. */
+    uint16_t u16Count;                      /*!< Number of frames in the queue. */
+    uint32_t u32Seq;                        /*!< Sequence number of the next queued frame. */
+    uint32_t u32UrgentKey;                  /*!< Frames with a key less than it are sent by PTB if PTB is free. */
+    uint8_t u8StbDepth;                     /*!< Maximum number of frames in STB. */
+    uint8_t u8StbCount;                     /*!< Number of frames in STB. */
+    uint8_t u8PtbBusy;                      /*!< PTB holds a frame. */
+} stc_can_tx_sched_t;
+
+/**
+ * @brief TTCAN system matrix slot structure.
+ */
+typedef struct {
+    uint16_t u16TriggerTime;                /*!< Start of the time window, number of NTU after the reference message. */
+    uint16_t u16TriggerType;                /*!< Trigger type of the time window.
+                                                 This parameter can be a value of @ref TTCAN_Trigger_Type */
+    uint8_t u8BaseCycle;                    /*!< The first basic cycle of the slot, less than u8RepeatFactor. */
+    uint8_t u8RepeatFactor;                 /*!< The slot is used in every u8RepeatFactor basic cycles, 1, 2, 4, ... 64. */
+    const stc_can_tx_frame_t *pstcTx;       /*!< Frame sent in the time window, it is read when the slot is loaded.
+                                                 NULL for a slot without transmission. */
+} stc_can_ttc_slot_t;
+
+/**
+ * @brief TTCAN schedule table engine structure.
+ * @note  The members are maintained by the driver, do not modify them after CAN_TTC_SchedInit().
+ */
+typedef struct {
+    CM_CAN_TypeDef *CANx;                   /*!< CAN unit of the engine. */
+    const stc_can_ttc_slot_t *pstcSlot;     /*!< System matrix slots of a basic cycle in increasing trigger time. */
+    uint16_t u16SlotNum;                    /*!< Number of slots. */
+    uint16_t u16NextSlot;                   /*!< The slot to be loaded after the current one. */
+    uint8_t u8CycleCount;                   /*!< Current basic cycle count. */
+    uint8_t u8TxBuf;                        /*!< Transmit buffer for the next transmission slot. */
+    uint8_t u8Armed;                        /*!< A trigger is loaded and waiting. */
+    uint8_t u8TrigErr;                      /*!< TEIF state at the last call of CAN_TTC_SchedIrqHandler(). */
+    uint32_t u32TrigErrCount;               /*!< Count of trigger errors. */
+    uint32_t u32WatchTrigCount;             /*!< Count of watch triggers, the reference message is missing. */
+} stc_can_ttc_sched_t;
+
 /**
  * @}
  */
@@ -693,6 +775,34 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup CAN_Tx_Sched CAN TX Scheduler
+ * @{
+ */
+#define CAN_STB_SLOT_NUM                (3U)                    /*!< Number of STB slots. */
+#define CAN_TTC_CYCLE_NUM_MAX           (64U)                   /*!< Maximum basic cycles of a TTCAN matrix cycle. */
+
+/**
+ * @brief  Arbitration key of a frame, a frame with a smaller key wins the bus arbitration.
+ * @param  [in] ide                     Identifier extension flag of the frame.
+ * @param  [in] id                      ID of the frame.
+ */
+#define CAN_TX_SCHED_KEY(ide, id)                                              \
+(   ((ide) == 0U) ? ((uint32_t)(id) << 19U) :                                   \
+    ((((uint32_t)(id) >> 18U) << 19U) | (1UL << 18U) | ((uint32_t)(id) & 0x3FFFFUL)))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CAN_Filter_Num CAN Acceptance Filter Number
+ * @{
+ */
+#define CAN_FILTER_NUM                  (16U)                   /*!< Number of acceptance filters of each CAN unit. */
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Global variable definitions ('extern')
  ******************************************************************************/
@@ -727,6 +837,20 @@ uint8_t CAN_GetRxBufStatus(const CM_CAN_TypeDef *CANx);
 void CAN_FilterCmd(CM_CAN_TypeDef *CANx, uint16_t u16FilterSelect, en_functional_state_t enNewState);
 void CAN_SetRxWarnLimit(CM_CAN_TypeDef *CANx, uint8_t u8RxWarnLimit);
 void CAN_SetErrorWarnLimit(CM_CAN_TypeDef *CANx, uint8_t u8ErrorWarnLimit);
+int32_t CAN_FilterPlan(const uint32_t au32ID[], uint32_t u32IdNum, uint32_t u32IDType,
+                       stc_can_filter_config_t astcFilter[], uint32_t u32FilterMax, uint16_t *pu16FilterSelect);
+
+int32_t CAN_RxRingInit(stc_can_rx_ring_t *pstcRing, stc_can_rx_entry_t *pstcEntry, uint32_t u32Size,
+                       uint32_t (*pfnGetTimestamp)(void));
+uint32_t CAN_RxRingIrqHandler(CM_CAN_TypeDef *CANx, stc_can_rx_ring_t *pstcRing);
+int32_t CAN_RxRingGet(stc_can_rx_ring_t *pstcRing, stc_can_rx_entry_t *pstcEntry);
+uint32_t CAN_RxRingGetCount(const stc_can_rx_ring_t *pstcRing);
+
+int32_t CAN_TxSchedInit(stc_can_tx_sched_t *pstcSched, CM_CAN_TypeDef *CANx, stc_can_tx_entry_t *pstcEntry,
+                        uint16_t *pu16Index, uint16_t u16Size, uint32_t u32UrgentKey, uint8_t u8StbDepth);
+int32_t CAN_TxSchedPut(stc_can_tx_sched_t *pstcSched, const stc_can_tx_frame_t *pstcTx);
+void CAN_TxSchedIrqHandler(stc_can_tx_sched_t *pstcSched);
+uint32_t CAN_TxSchedGetCount(const stc_can_tx_sched_t *pstcSched);
 
 int32_t CAN_FD_StructInit(stc_canfd_config_t *pstcCanFd);
 void CAN_FD_Cmd(const CM_CAN_TypeDef *CANx, en_functional_state_t enNewState);
@@ -750,6 +874,11 @@ int32_t CAN_TTC_FillTxFrame(CM_CAN_TypeDef *CANx, uint8_t u8CANTTCTxBuf, const s
 
 int32_t CAN_TTC_GetConfig(const CM_CAN_TypeDef *CANx, stc_can_ttc_config_t *pstcCanTtc);
 
+int32_t CAN_TTC_SchedInit(stc_can_ttc_sched_t *pstcSched, CM_CAN_TypeDef *CANx,
+                          const stc_can_ttc_slot_t *pstcSlot, uint16_t u16SlotNum);
+void CAN_TTC_SchedRefMsgHandler(stc_can_ttc_sched_t *pstcSched, uint8_t u8CycleCount);
+void CAN_TTC_SchedIrqHandler(stc_can_ttc_sched_t *pstcSched);
+
 /* RAM ECC management */
 void CAN_RAM_SetEccMode(CM_CAN_TypeDef *CANx, uint32_t u32EccMode);
 en_flag_status_t CAN_RAM_GetStatus(CM_CAN_TypeDef *CANx, uint32_t u32Flag);
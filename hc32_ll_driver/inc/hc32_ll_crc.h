@@ -8,6 +8,9 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-11-08       CDT             Modify interface of AccumulateData and Calculate functions
+   2026-10-18       CDT             Add CRC byte stream API with word write for aligned data
+   2026-10-18       CDT             Add CRC calculation fed by DMA
+   2026-10-18       CDT             Add CRC context to share the CRC unit between streams
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -66,6 +69,31 @@ typedef struct {
                                  This parameter can be CRC_INIT_VALUE_DEFAULT @ref CRC_Init_Value_Default */
 } stc_crc_init_t;
 
+/**
+ * @brief CRC context structure definition
+ * @note  A context keeps the state of one CRC stream so that several streams can share the CRC unit.
+ */
+typedef struct {
+    uint32_t u32Protocol;   /*!< Specifies CRC Protocol of the context.
+                                 This parameter can be a value of @ref CRC_Protocol_Control_Bit */
+    uint64_t u64Value;      /*!< Intermediate CRC value, saved when the context is switched out. */
+} stc_crc_ctx_t;
+
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief CRC DMA feeding structure definition
+ * @note  The members are maintained by the driver, do not modify them while a calculation is running.
+ */
+typedef struct {
+    CM_DMA_TypeDef *DMAx;       /*!< DMA unit used to feed the CRC data register. */
+    uint8_t u8Ch;               /*!< DMA channel used to feed the CRC data register. */
+    func_ptr_t pfnCallback;     /*!< Called from CRC_DMA_IrqHandler() when the calculation is completed, can be NULL. */
+    uint32_t u32SrcAddr;        /*!< Source address of the next chunk. */
+    uint32_t u32RemainLen;      /*!< Remaining length(counted in word) to be calculated. */
+    __IO uint32_t u32Busy;      /*!< Non-zero while a calculation is running. */
+} stc_crc_dma_t;
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @}
  */
@@ -117,6 +145,15 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup CRC_DMA_Chunk_Size CRC DMA Chunk Size
+ * @{
+ */
+#define CRC_DMA_CHUNK_SIZE_MAX      (1024UL)    /*!< Words written by one DMA request, the DMA block size limit. */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -142,20 +179,35 @@ void CRC_SetInitValue(uint64_t u64Value);
 en_flag_status_t CRC_GetResultStatus(void);
 
 int32_t CRC_CRC16_AccumulateData(uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint16_t *pu16Out);
+int32_t CRC_CRC16_AccumulateStream(const void *pvData, uint32_t u32Len, uint16_t *pu16Out);
 int32_t CRC_CRC16_Calculate(uint16_t u16InitValue, uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint16_t *pu16Out);
 en_flag_status_t CRC_CRC16_CheckData(uint16_t u16InitValue, uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint16_t u16ExpectValue);
 en_flag_status_t CRC_CRC16_GetCheckResult(uint16_t u16ExpectValue);
 
 int32_t CRC_CRC32_AccumulateData(uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint32_t *pu32Out);
+int32_t CRC_CRC32_AccumulateStream(const void *pvData, uint32_t u32Len, uint32_t *pu32Out);
 int32_t CRC_CRC32_Calculate(uint32_t u32InitValue, uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint32_t *pu32Out);
 en_flag_status_t CRC_CRC32_CheckData(uint32_t u32InitValue, uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint32_t u32ExpectValue);
 en_flag_status_t CRC_CRC32_GetCheckResult(uint32_t u32ExpectValue);
 
 int32_t CRC_CRC64_AccumulateData(uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint64_t *pu64Out);
+int32_t CRC_CRC64_AccumulateStream(const void *pvData, uint32_t u32Len, uint64_t *pu64Out);
 int32_t CRC_CRC64_Calculate(uint64_t u64InitValue, uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint64_t *pu64Out);
 en_flag_status_t CRC_CRC64_CheckData(uint64_t u64InitValue, uint8_t u8DataWidth, const void *pvData, uint32_t u32Len, uint64_t u64ExpectValue);
 en_flag_status_t CRC_CRC64_GetCheckResult(uint64_t u64ExpectValue);
 
+int32_t CRC_CtxInit(stc_crc_ctx_t *pstcCrcCtx, uint32_t u32Protocol, uint64_t u64InitValue);
+int32_t CRC_CtxDeInit(stc_crc_ctx_t *pstcCrcCtx);
+int32_t CRC_CtxSelect(stc_crc_ctx_t *pstcCrcCtx);
+
+#if (LL_DMA_ENABLE == DDL_ON)
+int32_t CRC_DMA_Init(stc_crc_dma_t *pstcCrcDma, CM_DMA_TypeDef *DMAx, uint8_t u8Ch, func_ptr_t pfnCallback);
+int32_t CRC_DMA_DeInit(stc_crc_dma_t *pstcCrcDma);
+int32_t CRC_DMA_Start(stc_crc_dma_t *pstcCrcDma, const uint32_t *pu32Data, uint32_t u32Len);
+void CRC_DMA_IrqHandler(stc_crc_dma_t *pstcCrcDma);
+en_flag_status_t CRC_DMA_GetBusyStatus(const stc_crc_dma_t *pstcCrcDma);
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @}
  */
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add DMA_SaveChConfig and DMA_RestoreChConfig functions
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -579,6 +580,8 @@ uint32_t DMA_GetNonSeqDestCount(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
 uint32_t DMA_GetNonSeqSrcOffset(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
 uint32_t DMA_GetNonSeqDestOffset(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
 void DMA_AHB_HProtBufCacheCmd(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, en_functional_state_t enNewState);
+int32_t DMA_SaveChConfig(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch, stc_dma_llp_descriptor_t *pstcConfig);
+int32_t DMA_RestoreChConfig(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_descriptor_t *pstcConfig);
 
 void DMA_MxChSWTrigger(CM_DMA_TypeDef *DMAx, uint8_t u8MxCh);
 void DMA_SWReconfig(CM_DMA_TypeDef *DMAx);
@@ -8,6 +8,8 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-10-17       CDT             Remove sample clock
+   2026-10-18       CDT             Add datasheet timing calculator and self-refresh enter/exit functions
+   2026-10-18       CDT             Add external memory bandwidth and latency benchmark
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -135,6 +137,44 @@ typedef struct {
     } stcTimingConfig;
 } stc_exmc_dmc_init_t;
 
+/**
+ * @brief  EXMC_DMC Datasheet Timing Structure definition
+ * @note   The timings are the minimum values of the SDRAM datasheet in nanoseconds, unless noted.
+ */
+typedef struct {
+    uint32_t u32RAS;                /*!< Active to precharge command period (tRAS), also the minimum self-refresh period */
+    uint32_t u32RC;                 /*!< Active to active command period (tRC) */
+    uint32_t u32RCD;                /*!< Active to read or write delay (tRCD) */
+    uint32_t u32RFC;                /*!< Auto refresh period (tRFC) */
+    uint32_t u32RP;                 /*!< Precharge command period (tRP) */
+    uint32_t u32RRD;                /*!< Active bank A to active bank B command period (tRRD) */
+    uint32_t u32WR;                 /*!< Write recovery time (tWR) */
+    uint32_t u32XP;                 /*!< Power-down exit time */
+    uint32_t u32XSR;                /*!< Exit self-refresh to active command period (tXSR) */
+    uint32_t u32RefreshTime;        /*!< Refresh time of all the rows (tREF) in milliseconds */
+    uint32_t u32RefreshRows;        /*!< Number of rows refreshed in u32RefreshTime, e.g. 4096 or 8192 */
+    uint32_t u32Cl2MaxFreq;         /*!< Maximum clock frequency in Hz at CAS latency 2, 0 if not supported */
+    uint32_t u32Cl3MaxFreq;         /*!< Maximum clock frequency in Hz at CAS latency 3 */
+} stc_exmc_dmc_timing_ns_t;
+
+/**
+ * @brief  EXMC Memory Benchmark Structure definition
+ * @note   The results are in CPU cycles, 0 for the DMA results if no DMA channel is given.
+ */
+typedef struct {
+    uint32_t u32Addr;               /*!< Start address of the test area in the DMC or SMC space, word aligned */
+    uint32_t u32Size;               /*!< Size of the test area in bytes, a power of 2 and no less than
+                                         EXMC_DMC_BENCH_SIZE_MIN */
+    uint32_t u32CpuSeqRead;         /*!< CPU reads the area word by word in address order */
+    uint32_t u32CpuSeqWrite;        /*!< CPU writes the area word by word in address order */
+    uint32_t u32CpuRandRead;        /*!< CPU reads the area word by word in scattered order */
+    uint32_t u32CpuRandWrite;       /*!< CPU writes the area word by word in scattered order */
+    uint32_t u32SingleLatency;      /*!< Average cycles of one word read whose address comes from the previous read */
+    uint32_t u32BurstLatency;       /*!< Average cycles of a read of EXMC_DMC_BENCH_BURST_LEN words in a scattered row */
+    uint32_t u32DmaRead;            /*!< DMA reads the area to an internal RAM word */
+    uint32_t u32DmaWrite;           /*!< DMA writes the area from an internal RAM word */
+} stc_exmc_dmc_bench_t;
+
 /**
  * @}
  */
@@ -336,6 +376,19 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup EXMC_DMC_Benchmark EXMC_DMC Benchmark
+ * @{
+ */
+#define EXMC_DMC_BENCH_SIZE_MIN             (1024UL)    /*!< Minimum size of the test area in bytes */
+#define EXMC_DMC_BENCH_BURST_LEN            (4UL)       /*!< Words read by one burst latency access */
+#ifndef EXMC_DMC_BENCH_DMA_TIMEOUT
+#define EXMC_DMC_BENCH_DMA_TIMEOUT          (0x100000UL)    /*!< Maximum count of reading the DMA status per block */
+#endif
+/**
+ * @}
+ */
+
 /*******************************************************************************
  * Global variable definitions ('extern')
  ******************************************************************************/
@@ -375,6 +428,13 @@ uint32_t EXMC_DMC_GetChipStartAddr(uint32_t u32Chip);
 uint32_t EXMC_DMC_GetChipEndAddr(uint32_t u32Chip);
 void EXMC_DMC_SetCommand(uint32_t u32Chip, uint32_t u32Bank, uint32_t u32Cmd, uint32_t u32Addr);
 
+int32_t EXMC_DMC_CalcTiming(const stc_exmc_dmc_timing_ns_t *pstcTimingNs, uint32_t u32ExclkFreq,
+                            stc_exmc_dmc_init_t *pstcDmcInit);
+int32_t EXMC_DMC_EnterSelfRefresh(uint32_t u32Timeout);
+int32_t EXMC_DMC_ExitSelfRefresh(uint32_t u32Timeout);
+
+int32_t EXMC_DMC_Benchmark(stc_exmc_dmc_bench_t *pstcBench, CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
+
 /**
  * @}
  */
@@ -8,6 +8,11 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-10-17       CDT             Add const before buffer pointer to cater top-level calls
+   2026-10-18       CDT             Add asynchronous erase/program job queue driven by EFM interrupt
+   2026-10-18       CDT             Add log-structured key-value store on EFM sectors
+   2026-10-18       CDT             Add A/B firmware update with HASH verification and swap rollback
+   2026-10-18       CDT             Add HCLK change helpers for wait cycles and fetch benchmark
+   2026-10-18       CDT             Add ECC error telemetry and background flash scrubber
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -121,6 +126,30 @@ typedef struct {
     uint32_t u32Reserved0: 4;
 } stc_efm_ecc_err_record_t;
 
+/**
+ * @brief EFM ECC scrubber definition
+ * @note  Only the first five members are set by the user, the others are maintained by the driver.
+ */
+typedef struct {
+    uint32_t u32StartAddr;                  /*!< Start address of the scrubbed range, sector aligned */
+    uint32_t u32EndAddr;                    /*!< End address of the scrubbed range(exclusive), sector aligned */
+    uint32_t u32UnitsPerStep;               /*!< Program units read by each EFM_ECC_ScrubStep(), the rate limit */
+    uint32_t u32RewriteThreshold;           /*!< Corrected errors of a sector in one pass that cause its rewrite */
+    uint8_t *pu8Buf;                        /*!< EFM_SECTOR_SIZE bytes word aligned buffer for the rewrite,
+                                                 NULL to only collect the errors */
+    uint32_t u32Addr;                       /*!< Next address to read */
+    uint32_t u32RewriteAddr;                /*!< Sector to be rewritten in the next step, EFM_ECC_SCRUB_ADDR_NONE if none */
+    uint32_t u32SectorErrCount;             /*!< Corrected errors of the sector being read */
+    uint32_t u32PassCount;                  /*!< Completed passes over the range */
+    uint32_t u32CorrectedCount;             /*!< Corrected(1-bit) errors */
+    uint32_t u32FatalCount;                 /*!< Uncorrectable(2-bit) errors */
+    uint32_t u32OverflowCount;              /*!< Times the error records overflowed */
+    uint32_t u32RewriteCount;               /*!< Rewritten sectors */
+    uint32_t u32LogCount;                   /*!< Errors written to au32ErrAddr */
+    uint32_t au32ErrAddr[8U];               /*!< Addresses of the latest errors, EFM_ECC_SCRUB_LOG_FATAL is set
+                                                 for the uncorrectable ones */
+} stc_efm_ecc_scrub_t;
+
 /**
  * @brief EFM ECC error injection bits definition
  * @note  Bit Mask for data @ref EFM_ECC_BIT_MASK_WORD
@@ -136,6 +165,62 @@ typedef struct {
     uint32_t u32AddrBit0_19;                /*!< data address bits 0~19 */
 } stc_efm_ecc_err_inject_bit_t;
 
+/**
+ * @brief EFM asynchronous job definition
+ * @note  The job is linked into the driver queue by EFM_AsyncSubmit(), keep it valid until i32Result
+ *        is no longer LL_ERR_BUSY.
+ */
+typedef struct stc_efm_job {
+    uint32_t u32Type;                       /*!< Job type @ref EFM_Job_Type */
+    uint32_t u32Addr;                       /*!< Sector address for erase, 16 bytes aligned start address for program */
+    const uint8_t *pu8Data;                 /*!< Data to be programmed, not used for erase */
+    uint32_t u32ByteLen;                    /*!< Length of the data in bytes, not used for erase */
+    func_ptr_t pfnCallback;                 /*!< Called from EFM_AsyncIrqHandler() when the job is finished, can be NULL */
+    __IO int32_t i32Result;                 /*!< LL_ERR_BUSY while queued or running, then LL_OK or LL_ERR */
+    uint32_t u32Offset;                     /*!< Bytes already programmed, maintained by the driver */
+    struct stc_efm_job *pstcNext;           /*!< Next job in the queue, maintained by the driver */
+} stc_efm_job_t;
+
+/**
+ * @brief EFM key-value store definition
+ * @note  Only the first four members are set by the user, the others are maintained by the driver.
+ */
+typedef struct {
+    uint32_t u32StartAddr;                  /*!< Address of the first reserved sector, sector aligned */
+    uint32_t u32SectorNum;                  /*!< Number of reserved sectors, at least 3 */
+    uint32_t *pu32Index;                    /*!< RAM index, one word per slot */
+    uint32_t u32IndexSize;                  /*!< Number of index slots, power of 2 and greater than the number of keys */
+    uint32_t u32KeyCount;                   /*!< Number of keys in the index, including deleted ones not yet collected */
+    uint32_t u32OldestSector;               /*!< Sector index of the oldest used sector */
+    uint32_t u32ActiveSector;               /*!< Sector index of the sector being appended */
+    uint32_t u32UsedSectorNum;              /*!< Number of used sectors */
+    uint32_t u32WriteAddr;                  /*!< Next data address in the active sector */
+    uint32_t u32EntryAddr;                  /*!< Next record entry address in the active sector */
+    uint32_t u32Seq;                        /*!< Sequence number of the active sector */
+    uint32_t u32GcAddr;                     /*!< Next entry to collect in the oldest sector, 0 if no collection is running */
+} stc_efm_kv_t;
+
+/**
+ * @brief EFM A/B firmware update definition
+ * @note  Maintained by the driver, set up by EFM_FW_UpdateStart().
+ */
+typedef struct {
+    uint32_t u32ImageSize;                  /*!< Size of the image in bytes */
+    uint32_t u32Offset;                     /*!< Number of image bytes received */
+    uint32_t u32EraseAddr;                  /*!< End address of the erased area in the inactive bank */
+    uint8_t au8Unit[16U];                   /*!< Received bytes of the incomplete program unit */
+} stc_efm_fw_update_t;
+
+/**
+ * @brief EFM instruction fetch benchmark setting
+ */
+typedef struct {
+    uint32_t u32WaitCycle;                  /*!< Read wait cycles, @ref EFM_Wait_Cycle */
+    uint32_t u32ReadAccl;                   /*!< Read accelerators, 0 or any combination of EFM_RD_ACCL_CMD_PREFETCH,
+                                                 EFM_RD_ACCL_CMD_DCACHE and EFM_RD_ACCL_CMD_ICACHE */
+    uint32_t u32Cycles;                     /*!< CPU cycles measured by EFM_FetchBenchmark() */
+} stc_efm_fetch_bench_t;
+
 /**
  * @}
  */
@@ -232,6 +317,10 @@ typedef struct {
 #define EFM_WAIT_CYCLE13                (13U << EFM_FRMC_FLWT_POS)     /*!< Insert 13 read wait cycles   */
 #define EFM_WAIT_CYCLE14                (14U << EFM_FRMC_FLWT_POS)     /*!< Insert 14 read wait cycles   */
 #define EFM_WAIT_CYCLE15                (15U << EFM_FRMC_FLWT_POS)     /*!< Insert 15 read wait cycles   */
+
+#ifndef EFM_WAIT_CYCLE_FREQ_STEP
+#define EFM_WAIT_CYCLE_FREQ_STEP        (40000000UL)   /*!< HCLK range of one read wait cycle, 0 wait cycle up to 40MHz */
+#endif
 /**
  * @}
  */
@@ -383,6 +472,41 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup EFM_Job_Type EFM Asynchronous Job Type
+ * @{
+ */
+#define EFM_JOB_ERASE_SECTOR            (0UL)       /*!< Erase the sector containing u32Addr   */
+#define EFM_JOB_PGM                     (1UL)       /*!< Program u32ByteLen bytes from u32Addr */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EFM_KV_Definition EFM Key-value Store Definition
+ * @{
+ */
+#define EFM_KV_KEY_INVD                 (0xFFFFFFFFUL)  /*!< Reserved, marks blank flash */
+#define EFM_KV_DATA_SIZE_MAX            (0x2000UL - 32UL) /*!< EFM_SECTOR_SIZE minus sector header and record entry */
+#ifndef EFM_KV_GC_THRESHOLD
+#define EFM_KV_GC_THRESHOLD             (3UL)           /*!< EFM_KV_GcStep() collects when less free sectors are left */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EFM_FW_Definition EFM A/B Firmware Update Definition
+ * @{
+ */
+#define EFM_FW_BANK_SIZE                (0x00100000UL)  /*!< One flash chip, swapped as a whole */
+#define EFM_FW_IMAGE_SIZE_MAX           (EFM_FW_BANK_SIZE - 0x2000UL) /*!< The last sector keeps the image trailer */
+#define EFM_FW_DIGEST_SIZE              (32UL)          /*!< SHA256 */
+#define EFM_FW_BOOT_ATTEMPT_MAX         ((0x2000UL - 64UL) / 16UL) /*!< Trial boot marks after the trailer */
+/**
+ * @}
+ */
+
 /**
  * @defgroup EFM_Sector_Size EFM Sector Size
  * @{
@@ -654,6 +778,17 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup EFM_ECC_Scrub EFM ECC Scrubber
+ * @{
+ */
+#define EFM_ECC_SCRUB_LOG_SIZE                              (8UL)   /*!< Entries of stc_efm_ecc_scrub_t::au32ErrAddr */
+#define EFM_ECC_SCRUB_LOG_FATAL                             (1UL)   /*!< Uncorrectable error mark in a logged address */
+#define EFM_ECC_SCRUB_ADDR_NONE                             (0xFFFFFFFFUL) /*!< No sector rewrite is pending */
+/**
+ * @}
+ */
+
 /**
  * @defgroup EFM_ECC_Bit_Mask EFM ECC Bit Mask
  * @{
@@ -739,6 +874,30 @@ int32_t EFM_ChipErase(uint32_t u32Chip);
 
 int32_t EFM_SectorErase(uint32_t u32Addr);
 
+int32_t EFM_AsyncInit(void);
+int32_t EFM_AsyncDeInit(void);
+int32_t EFM_AsyncSubmit(stc_efm_job_t *pstcJob);
+void EFM_AsyncIrqHandler(void);
+en_flag_status_t EFM_AsyncGetBusyStatus(void);
+
+#if (LL_CRC_ENABLE == DDL_ON)
+int32_t EFM_KV_Init(stc_efm_kv_t *pstcKv);
+int32_t EFM_KV_Format(stc_efm_kv_t *pstcKv);
+int32_t EFM_KV_Set(stc_efm_kv_t *pstcKv, uint32_t u32Key, const void *pvData, uint16_t u16Len);
+int32_t EFM_KV_Get(const stc_efm_kv_t *pstcKv, uint32_t u32Key, void *pvData, uint16_t u16Size, uint16_t *pu16Len);
+int32_t EFM_KV_Delete(stc_efm_kv_t *pstcKv, uint32_t u32Key);
+int32_t EFM_KV_GcStep(stc_efm_kv_t *pstcKv);
+#endif /* LL_CRC_ENABLE */
+
+#if (LL_HASH_ENABLE == DDL_ON)
+int32_t EFM_FW_UpdateStart(stc_efm_fw_update_t *pstcUpdate, uint32_t u32ImageSize);
+int32_t EFM_FW_UpdateWrite(stc_efm_fw_update_t *pstcUpdate, const uint8_t *pu8Data, uint32_t u32Len);
+int32_t EFM_FW_UpdateFinish(stc_efm_fw_update_t *pstcUpdate, const uint8_t *pu8Digest);
+int32_t EFM_FW_UpdateAbort(stc_efm_fw_update_t *pstcUpdate);
+int32_t EFM_FW_BootCheck(uint32_t u32AttemptMax);
+int32_t EFM_FW_Confirm(void);
+#endif /* LL_HASH_ENABLE */
+
 en_flag_status_t EFM_GetAnyStatus(uint32_t u32Flag);
 en_flag_status_t EFM_GetStatus(uint32_t u32Flag);
 void EFM_GetUID(stc_efm_unique_id_t *pstcUID);
@@ -748,6 +907,10 @@ void EFM_PrefetchCmd(en_functional_state_t enNewState);
 void EFM_DCacheCmd(en_functional_state_t enNewState);
 void EFM_ICacheCmd(en_functional_state_t enNewState);
 void EFM_ReadAcceleratorCmd(uint32_t u32CmdType, en_functional_state_t enNewState);
+uint32_t EFM_GetMinWaitCycle(uint32_t u32HclkFreq);
+int32_t EFM_ClockChangeStart(uint32_t u32NewHclkFreq);
+int32_t EFM_ClockChangeEnd(uint32_t u32NewHclkFreq);
+int32_t EFM_FetchBenchmark(func_ptr_t pfnCode, uint32_t u32Loop, stc_efm_fetch_bench_t *pstcBench, uint32_t u32Num);
 void EFM_LowVoltageReadCmd(en_functional_state_t enNewState);
 int32_t EFM_SwapCmd(en_functional_state_t enNewState);
 en_flag_status_t EFM_GetSwapStatus(void);
@@ -789,6 +952,9 @@ void EFM_ECC_ClearErrorRecord(uint32_t u32Chip, uint32_t u32Record);
 void EFM_ECC_ErrorInjectCmd(uint32_t u32Chip, en_functional_state_t enNewState);
 void EFM_ECC_ErrorInjectBitCmd(uint32_t u32Chip, const stc_efm_ecc_err_inject_bit_t *pstcBitSel, en_functional_state_t enNewState);
 
+int32_t EFM_ECC_ScrubInit(stc_efm_ecc_scrub_t *pstcScrub);
+int32_t EFM_ECC_ScrubStep(stc_efm_ecc_scrub_t *pstcScrub);
+
 /**
  * @}
  */
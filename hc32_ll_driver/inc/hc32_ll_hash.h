@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add Hash_DRBG based on SHA256
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -49,6 +50,36 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup HASH_Global_Types HASH Global Types
+ * @{
+ */
+
+/**
+ * @brief Hash_DRBG(NIST SP800-90A, SHA256) seed material structure
+ */
+typedef struct {
+    const uint8_t *pu8Entropy;          /*!< Pointer to the entropy input, e.g. read from TRNG. */
+    uint32_t u32EntropySize;            /*!< Size(in byte) of the entropy input.
+                                             This parameter must be between HASH_DRBG_ENTROPY_SIZE_MIN and HASH_DRBG_INPUT_SIZE_MAX */
+    const uint8_t *pu8Nonce;            /*!< Pointer to the nonce, set it to NULL if not used. */
+    uint32_t u32NonceSize;              /*!< Size(in byte) of the nonce, not greater than HASH_DRBG_INPUT_SIZE_MAX. */
+    const uint8_t *pu8PersStr;          /*!< Pointer to the personalization string, set it to NULL if not used. */
+    uint32_t u32PersStrSize;            /*!< Size(in byte) of the personalization string, not greater than HASH_DRBG_INPUT_SIZE_MAX. */
+} stc_hash_drbg_seed_t;
+
+/**
+ * @brief Hash_DRBG(NIST SP800-90A, SHA256) working state structure
+ */
+typedef struct {
+    uint8_t au8V[55U];                  /*!< Value V of the working state, HASH_DRBG_SEED_SIZE bytes. */
+    uint8_t au8C[55U];                  /*!< Constant C of the working state, HASH_DRBG_SEED_SIZE bytes. */
+    uint32_t u32ReseedCounter;          /*!< Number of requests since instantiation or reseeding. 0 means not instantiated. */
+} stc_hash_drbg_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -58,6 +89,21 @@ extern "C"
  * @{
  */
 
+/**
+ * @defgroup HASH_DRBG_Size HASH DRBG Size
+ * @{
+ */
+#define HASH_DRBG_SEED_SIZE         (55U)                       /*!< seedlen of SHA256 Hash_DRBG, 440 bits */
+#define HASH_DRBG_ENTROPY_SIZE_MIN  (32U)                       /*!< 256 bits security strength */
+#define HASH_DRBG_INPUT_SIZE_MAX    (64U)                       /*!< Max. size of entropy, nonce, personalization string or additional input */
+#define HASH_DRBG_REQUEST_SIZE_MAX  (65536UL)                   /*!< Max. size of one generating request, 2^19 bits */
+#ifndef HASH_DRBG_RESEED_INTERVAL
+#define HASH_DRBG_RESEED_INTERVAL   (0x10000UL)                 /*!< Number of requests allowed between two reseeds */
+#endif
+/**
+ * @}
+ */
+
 /**
  * @defgroup HASH_Mode HASH Mode
  * @{
@@ -204,6 +250,13 @@ uint32_t HASH_GetDataType(void);
 int32_t HASH_Start(void);
 void HASH_GetMsgDigest(uint8_t *pu8MsgDigest);
 
+int32_t HASH_DRBG_Init(stc_hash_drbg_t *pstcDrbg, const stc_hash_drbg_seed_t *pstcSeed);
+int32_t HASH_DRBG_DeInit(stc_hash_drbg_t *pstcDrbg);
+int32_t HASH_DRBG_Reseed(stc_hash_drbg_t *pstcDrbg, const uint8_t *pu8Entropy, uint32_t u32EntropySize,
+                         const uint8_t *pu8AddInput, uint32_t u32AddInputSize);
+int32_t HASH_DRBG_Generate(stc_hash_drbg_t *pstcDrbg, uint8_t *pu8Out, uint32_t u32Size,
+                           const uint8_t *pu8AddInput, uint32_t u32AddInputSize);
+
 /**
  * @}
  */
@@ -7,6 +7,8 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add message RAM planner and zero-copy Rx access
+   2026-10-18       CDT             Add batched Tx FIFO/queue submission and Tx event retrieval
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -166,6 +168,40 @@ typedef struct {
                                                  address(u32AddrOffset) of the next MCAN to be configured. */
 } stc_mcan_msg_ram_config_t;
 
+/**
+ * @brief MCAN message RAM demand structure definition
+ * @note  The element numbers of Rx FIFO0, Rx FIFO1, Tx FIFO/queue and Tx event FIFO are the minimum numbers,
+ *        @ref MCAN_MsgRamPlan() extends the FIFOs whose minimum number is not zero to fill u32RamSize.
+ */
+typedef struct {
+    uint32_t u32AddrOffset;                 /*!< Specifies the message RAM start address, 4 bytes aligned. */
+    uint32_t u32RamSize;                    /*!< Specifies the message RAM size in bytes given to the MCAN. */
+    uint32_t u32StdFilterNum;               /*!< Specifies the number of standard message ID filters, 0 ~ 128. */
+    uint32_t u32ExtFilterNum;               /*!< Specifies the number of extended message ID filters, 0 ~ 64. */
+    uint32_t u32RxFifo0Num;                 /*!< Specifies the minimum number of Rx FIFO0 elements, 0 ~ 64. */
+    uint32_t u32RxFifo0MaxData;             /*!< Specifies the largest payload received by Rx FIFO0 in bytes, 0 ~ 64. */
+    uint32_t u32RxFifo1Num;                 /*!< Specifies the minimum number of Rx FIFO1 elements, 0 ~ 64. */
+    uint32_t u32RxFifo1MaxData;             /*!< Specifies the largest payload received by Rx FIFO1 in bytes, 0 ~ 64. */
+    uint32_t u32RxBufferNum;                /*!< Specifies the number of dedicated Rx buffers, 0 ~ 64. */
+    uint32_t u32RxBufferMaxData;            /*!< Specifies the largest payload received by Rx buffers in bytes, 0 ~ 64. */
+    uint32_t u32TxBufferNum;                /*!< Specifies the number of dedicated Tx buffers. */
+    uint32_t u32TxFifoQueueNum;             /*!< Specifies the minimum number of Tx FIFO/queue elements.
+                                                 The sum of u32TxFifoQueueNum and u32TxBufferNum must be a number between 0 and 32 */
+    uint32_t u32TxFifoQueueMode;            /*!< Specifies Tx FIFO/Queue operation mode.
+                                                 This parameter can be a value of @ref MCAN_Tx_FIFO_Queue_Mode */
+    uint32_t u32TxMaxData;                  /*!< Specifies the largest payload to be transmitted in bytes, 0 ~ 64. */
+    uint32_t u32TxEventNum;                 /*!< Specifies the minimum number of Tx event FIFO elements, 0 ~ 32. */
+} stc_mcan_msg_ram_demand_t;
+
+/**
+ * @brief MCAN Rx element in the message RAM, see @ref MCAN_Rx_Element_Access
+ */
+typedef struct {
+    __I uint32_t R0;                        /*!< ESI, XTD, RTR and ID. */
+    __I uint32_t R1;                        /*!< ANMF, FIDX, FDF, BRS, DLC and RXTS. */
+    __I uint32_t au32Data[16U];             /*!< Payload, little endian. Only the configured data field size is valid. */
+} stc_mcan_rx_elmt_t;
+
 /**
  * @brief MCAN filter structure definition
  */
@@ -1004,6 +1040,27 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup MCAN_Rx_Element_Access MCAN Rx Element Access
+ * @brief    Decode a @ref stc_mcan_rx_elmt_t in place.
+ * @{
+ */
+#define MCAN_RX_ELMT_IDE(p)             (((p)->R0 >> 30U) & 0x1UL)
+#define MCAN_RX_ELMT_ID(p)              ((MCAN_RX_ELMT_IDE(p) == MCAN_STD_ID) ? \
+                                         (((p)->R0 >> 18U) & MCAN_STD_ID_MASK) : ((p)->R0 & MCAN_EXT_ID_MASK))
+#define MCAN_RX_ELMT_RTR(p)             (((p)->R0 >> 29U) & 0x1UL)
+#define MCAN_RX_ELMT_ESI(p)             ((p)->R0 >> 31U)
+#define MCAN_RX_ELMT_TIMESTAMP(p)       ((p)->R1 & 0xFFFFUL)
+#define MCAN_RX_ELMT_DLC(p)             (((p)->R1 >> 16U) & 0xFUL)
+#define MCAN_RX_ELMT_BRS(p)             (((p)->R1 >> 20U) & 0x1UL)
+#define MCAN_RX_ELMT_FDF(p)             (((p)->R1 >> 21U) & 0x1UL)
+#define MCAN_RX_ELMT_FILTER_INDEX(p)    (((p)->R1 >> 24U) & 0x7FUL)
+#define MCAN_RX_ELMT_NMF(p)             ((p)->R1 >> 31U)
+#define MCAN_RX_ELMT_DATA_BYTE(p, n)    ((uint8_t)((p)->au32Data[(n) >> 2U] >> (((n) & 0x3UL) * 8U)))
+/**
+ * @}
+ */
+
 /**
  * @defgroup MCAN_RAM_ECC_Mode MCAN RAM ECC Mode
  * @{
@@ -1066,6 +1123,7 @@ int32_t MCAN_Stop(CM_MCAN_TypeDef *MCANx);
 int32_t MCAN_EnterSleepMode(CM_MCAN_TypeDef *MCANx);
 int32_t MCAN_ExitSleepMode(CM_MCAN_TypeDef *MCANx);
 int32_t MCAN_GetMsgRamAddr(const CM_MCAN_TypeDef *MCANx, stc_mcan_msg_ram_addr_t *pstcAddr);
+int32_t MCAN_MsgRamPlan(const stc_mcan_msg_ram_demand_t *pstcDemand, stc_mcan_msg_ram_config_t *pstcMsgRam);
 
 /* Configuration functions ****************************************************/
 int32_t MCAN_FilterConfig(const CM_MCAN_TypeDef *MCANx, const stc_mcan_filter_t *pstcFilter);
@@ -1093,11 +1151,18 @@ void MCAN_TxEventMsgMarkerConfig(CM_MCAN_TypeDef *MCANx, uint32_t u32MsgMarker);
 
 /* Control functions **********************************************************/
 int32_t MCAN_AddMsgToTxFifoQueue(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t *pTxMsg);
+int32_t MCAN_AddMsgsToTxFifoQueue(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t astcTxMsg[],
+                                  uint32_t u32MsgNum, uint32_t *pu32AddedNum);
 int32_t MCAN_AddMsgToTxBuffer(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t *pTxMsg);
 void MCAN_EnableTxBufferRequest(CM_MCAN_TypeDef *MCANx, uint32_t u32TxBuffer);
 void MCAN_AbortTxRequest(CM_MCAN_TypeDef *MCANx, uint32_t u32TxBuffer);
 int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_rx_msg_t *pRxMsg);
+int32_t MCAN_PeekRxMsg(const CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation,
+                       const stc_mcan_rx_elmt_t **ppstcElmt, uint32_t *pu32GetIndex);
+void MCAN_AckRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, uint32_t u32GetIndex);
 int32_t MCAN_GetTxEvent(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_event_t *pTxEvent);
+int32_t MCAN_GetTxEvents(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_event_t astcTxEvent[],
+                         uint32_t u32MaxNum, uint32_t *pu32GetNum);
 int32_t MCAN_GetHighPriorityMsgStatus(const CM_MCAN_TypeDef *MCANx, stc_mcan_hpm_status_t *pHpmStatus);
 
 int32_t MCAN_GetProtocolStatus(const CM_MCAN_TypeDef *MCANx, stc_mcan_protocol_status_t *pProtocolStatus);
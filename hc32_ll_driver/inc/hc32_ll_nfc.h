@@ -7,6 +7,8 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add page pipeline engine with cache read/program and DMA
+   2026-10-18       CDT             Add functions to get the page size, spare area size, page number and ECC mode
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -34,6 +36,9 @@ extern "C"
 
 #include "hc32f4xx.h"
 #include "hc32f4xx_conf.h"
+#if (LL_DMA_ENABLE == DDL_ON)
+#include "hc32_ll_dma.h"
+#endif
 
 /**
  * @addtogroup LL_Driver
@@ -150,6 +155,27 @@ typedef struct {
                                                           This structure details refer @ref stc_exmc_nfc_timing_reg2_config_t. */
 } stc_exmc_nfc_init_t;
 
+/**
+ * @brief  EXMC_NFC page pipeline job definition
+ * @note   The job is linked into the driver queue by EXMC_NFC_PipeSubmit(), keep it and its buffer valid
+ *         until i32Result is no longer LL_ERR_BUSY.
+ */
+typedef struct stc_exmc_nfc_job {
+    uint32_t u32Type;                   /*!< Job type @ref EXMC_NFC_Job_Type */
+    uint32_t u32Bank;                   /*!< Defines the bank.
+                                             This parameter can be a value of @ref EXMC_NFC_Bank */
+    uint32_t u32Page;                   /*!< First page of the job, the pages are accessed sequentially */
+    uint32_t u32PageNum;                /*!< Number of the pages */
+    uint8_t *pu8Data;                   /*!< Word aligned buffer of u32PageNum * u32PageBytes bytes */
+    uint32_t u32PageBytes;              /*!< Bytes moved per page from column 0, a multiple of 4 not larger
+                                             than the page size plus the spare size for user data */
+    func_ptr_t pfnCallback;             /*!< Called from EXMC_NFC_PipeIrqHandler() when the job is finished, can be NULL */
+    __IO int32_t i32Result;             /*!< LL_ERR_BUSY while queued or running, then LL_OK or LL_ERR */
+    uint32_t u32Index;                  /*!< Pages already moved, maintained by the driver */
+    uint32_t u32Offset;                 /*!< Words of the current page already moved, maintained by the driver */
+    struct stc_exmc_nfc_job *pstcNext;  /*!< Next job in the queue, maintained by the driver */
+} stc_exmc_nfc_job_t;
+
 /**
  * @}
  */
@@ -386,6 +412,16 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup EXMC_NFC_Job_Type EXMC_NFC Page Pipeline Job Type
+ * @{
+ */
+#define EXMC_NFC_JOB_RD                         (0UL)   /*!< Sequential cache read of u32PageNum pages    */
+#define EXMC_NFC_JOB_PGM                        (1UL)   /*!< Sequential cache program of u32PageNum pages */
+/**
+ * @}
+ */
+
 /**
  * @defgroup EXMC_NFC_Memory_Command EXMC_NFC Memory Command
  * @{
@@ -546,6 +582,10 @@ uint32_t EXMC_NFC_Get1BitEccErrBitLocation(uint32_t u32Section);
 uint32_t EXMC_NFC_Get1BitEccErrByteLocation(uint32_t u32Section);
 void EXMC_NFC_SetSpareAreaSize(uint8_t u8SpareSizeForUserData);
 void EXMC_NFC_SetEccMode(uint32_t u32EccMode);
+uint32_t EXMC_NFC_GetEccMode(void);
+uint32_t EXMC_NFC_GetPageSize(void);
+uint32_t EXMC_NFC_GetSpareAreaSize(void);
+uint32_t EXMC_NFC_GetPageNum(void);
 int32_t EXMC_NFC_GetSyndrome(uint32_t u32Section, uint16_t au16Synd[], uint8_t u8Len);
 
 /* EXMC_NFC command functions */
@@ -578,6 +618,15 @@ int32_t EXMC_NFC_ReadPageHwEcc(uint32_t u32Bank, uint32_t u32Page,
                                uint8_t *pu8Data, uint32_t u32NumBytes, uint32_t u32Timeout);
 int32_t EXMC_NFC_WritePageHwEcc(uint32_t u32Bank, uint32_t u32Page,
                                 const uint8_t *pu8Data, uint32_t u32NumBytes, uint32_t u32Timeout);
+
+#if (LL_DMA_ENABLE == DDL_ON)
+/* EXMC_NFC page pipeline functions */
+int32_t EXMC_NFC_PipeInit(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint32_t u32PagesPerBlock);
+int32_t EXMC_NFC_PipeDeInit(void);
+int32_t EXMC_NFC_PipeSubmit(stc_exmc_nfc_job_t *pstcJob);
+void EXMC_NFC_PipeIrqHandler(void);
+en_flag_status_t EXMC_NFC_PipeGetBusyStatus(void);
+#endif
 /**
  * @}
  */
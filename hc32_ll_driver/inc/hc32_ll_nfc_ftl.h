@@ -0,0 +1,197 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_nfc_ftl.h
+ * @brief This file contains all the functions prototypes of the flash
+ *        translation layer on top of the EXMC NFC (NAND Flash Controller)
+ *        driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_NFC_FTL_H__
+#define __HC32_LL_NFC_FTL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f4xx.h"
+#include "hc32f4xx_conf.h"
+#include "hc32_ll_nfc.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_EXMC
+ * @{
+ */
+
+/**
+ * @addtogroup LL_NFC_FTL
+ * @{
+ */
+
+#if (LL_NFC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup EXMC_NFC_FTL_Global_Types EXMC_NFC_FTL Global Types
+ * @{
+ */
+
+/**
+ * @brief  EXMC_NFC flash translation layer block information definition
+ */
+typedef struct {
+    uint32_t u32EraseCount;             /*!< Erase count of the block */
+    uint32_t u32Seq;                    /*!< Sequence number of the first page of the block, 0 if not written */
+    uint16_t u16ValidPages;             /*!< Pages holding the current copy of a logical page */
+    uint16_t u16State;                  /*!< Block state @ref EXMC_NFC_FTL_Block_State */
+} stc_exmc_nfc_ftl_blk_t;
+
+/**
+ * @brief  EXMC_NFC flash translation layer definition
+ * @note   Only the members up to u32Timeout are set by the user, the others are maintained by the driver.
+ */
+typedef struct {
+    uint32_t u32Bank;                   /*!< Defines the bank.
+                                             This parameter can be a value of @ref EXMC_NFC_Bank */
+    uint32_t u32StartBlock;             /*!< First block of the FTL area */
+    uint32_t u32BlockNum;               /*!< Number of blocks of the FTL area, including the bad ones */
+    uint32_t u32PagesPerBlock;          /*!< Pages per block of the device */
+    uint32_t u32LogicPageNum;           /*!< Number of logical pages, each of the page size */
+    uint32_t *pu32Map;                  /*!< RAM logical to physical page map, u32LogicPageNum words */
+    stc_exmc_nfc_ftl_blk_t *pstcBlk;    /*!< RAM block table, u32BlockNum entries */
+    uint8_t *pu8PageBuf;                /*!< Word aligned buffer of page size + EXMC_NFC_FTL_SPARE_SIZE bytes */
+    uint32_t u32CkptInterval;           /*!< Page writes between automatic checkpoints,
+                                             0 for EXMC_NFC_FTL_Checkpoint() only */
+    uint32_t u32Timeout;                /*!< Timeout of each NFC operation (Max value @ref EXMC_NFC_Max_Timeout) */
+    uint32_t u32Seq;                    /*!< Sequence number of the last written page */
+    uint32_t u32CkptSeq;                /*!< Sequence number of the last checkpoint */
+    uint32_t au32CkptBlock[2U];         /*!< The two blocks holding the checkpoints in turn */
+    uint32_t u32CkptCurr;               /*!< Index in au32CkptBlock of the block being appended */
+    uint32_t u32CkptPage;               /*!< Next free page of the checkpoint block */
+    uint32_t u32ActiveBlock;            /*!< Block being appended */
+    uint32_t u32ActivePage;             /*!< Next free page of the active block */
+    uint32_t u32FreeBlockNum;           /*!< Number of erased blocks */
+    uint32_t u32DirtyPages;             /*!< Pages written since the last checkpoint */
+    int32_t i32CkptResult;              /*!< Result of the last EXMC_NFC_FTL_Checkpoint(), also the ones made by
+                                             EXMC_NFC_FTL_Write() */
+} stc_exmc_nfc_ftl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EXMC_NFC_FTL_Global_Macros EXMC_NFC_FTL Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup EXMC_NFC_FTL_Definition EXMC_NFC Flash Translation Layer Definition
+ * @{
+ */
+#define EXMC_NFC_FTL_UNMAPPED                   (0xFFFFFFFFUL)  /*!< Map value of a logical page never written */
+#define EXMC_NFC_FTL_SPARE_SIZE                 (20UL)  /*!< Spare bytes for user data used per page */
+#ifndef EXMC_NFC_FTL_GC_THRESHOLD
+#define EXMC_NFC_FTL_GC_THRESHOLD               (2UL)   /*!< Writes collect garbage when less blocks are free */
+#endif
+#ifndef EXMC_NFC_FTL_WEAR_LIMIT
+#define EXMC_NFC_FTL_WEAR_LIMIT                 (256UL) /*!< Erase count spread that makes EXMC_NFC_FTL_GcStep()
+                                                             move cold data */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EXMC_NFC_FTL_Block_State EXMC_NFC Flash Translation Layer Block State
+ * @{
+ */
+#define EXMC_NFC_FTL_BLK_FREE                   (0U)    /*!< Erased                                         */
+#define EXMC_NFC_FTL_BLK_ACTIVE                 (1U)    /*!< Being appended                                 */
+#define EXMC_NFC_FTL_BLK_USED                   (2U)    /*!< Written                                        */
+#define EXMC_NFC_FTL_BLK_RETIRE                 (3U)    /*!< Program failed, marked bad once collected      */
+#define EXMC_NFC_FTL_BLK_CKPT                   (4U)    /*!< Holds the checkpoints                          */
+#define EXMC_NFC_FTL_BLK_BAD                    (5U)    /*!< Bad block                                      */
+#define EXMC_NFC_FTL_BLK_DAMAGED                (6U)    /*!< Holds valid pages which can not be read, not
+                                                             collected until they are rewritten             */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup EXMC_NFC_FTL_Global_Functions
+ * @{
+ */
+int32_t EXMC_NFC_FTL_Format(stc_exmc_nfc_ftl_t *pstcFtl);
+int32_t EXMC_NFC_FTL_Init(stc_exmc_nfc_ftl_t *pstcFtl);
+int32_t EXMC_NFC_FTL_Read(const stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Lpn, uint8_t *pu8Data);
+int32_t EXMC_NFC_FTL_Write(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Lpn, const uint8_t *pu8Data);
+int32_t EXMC_NFC_FTL_Checkpoint(stc_exmc_nfc_ftl_t *pstcFtl);
+int32_t EXMC_NFC_FTL_GcStep(stc_exmc_nfc_ftl_t *pstcFtl);
+/**
+ * @}
+ */
+
+#endif /* LL_NFC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_NFC_FTL_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -7,6 +7,8 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add memory mapped read profiler with read setting selection
+   2026-10-18       CDT             Add flash program/erase service with DMA page writes
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -93,6 +95,43 @@ typedef struct {
                                              This parameter must be a number between Min_Data = 0x0 and Max_Data = 0xFF */
 } stc_qspi_custom_mode_t;
 
+/**
+ * @brief QSPI memory mapped read profile structure definition
+ */
+typedef struct {
+    uint32_t u32ReadMode;               /*!< Specifies the read mode.
+                                             This parameter can be a value of @ref QSPI_Read_Mode */
+    uint32_t u32DummyCycle;             /*!< Specifies the number of dummy cycles.
+                                             This parameter can be a value of @ref QSPI_Dummy_Cycle */
+    uint32_t u32PrefetchMode;           /*!< Specifies the prefetch mode.
+                                             This parameter can be a value of @ref QSPI_Prefetch_Mode */
+    int32_t  i32Result;                 /*!< LL_OK if the pattern is read back correctly, LL_ERR otherwise */
+    uint32_t u32SeqCycles;              /*!< CPU cycles of reading the pattern sequentially by words */
+    uint32_t u32RandCycles;             /*!< CPU cycles of reading as many words at random offsets */
+} stc_qspi_read_profile_t;
+
+/**
+ * @brief QSPI flash program/erase service structure definition
+ * @note  Only the members up to u32PageSize are set by the user, the others are maintained by the driver.
+ *        Initialize it by QSPI_FlashInit() or QSPI_FlashStructInit() before use.
+ */
+typedef struct {
+    CM_DMA_TypeDef *DMAx;               /*!< DMA unit moving the page data to the direct communication register,
+                                             NULL to write the page data by CPU */
+    uint8_t  u8DmaCh;                   /*!< DMA channel, @ref DMA_Channel_selection */
+    uint8_t  u8PageProgramInstr;        /*!< Page program instruction of the flash, sent on 1 line */
+    uint8_t  u8XipModeCode;             /*!< Mode code to re-enter XIP mode if XIP mode was on */
+    uint8_t  u8FailStatusInstr;         /*!< Instruction reading the program/erase fail flags of the flash, e.g. 0x2B
+                                             or 0x70, QSPI_FLASH_INSTR_NONE if the flash has no such register */
+    uint8_t  u8FailStatusMask;          /*!< Program/erase fail flags in the register read by u8FailStatusInstr */
+    uint32_t u32PageSize;               /*!< Program page size of the flash in bytes, a power of 2 up to 1024 */
+    uint32_t u32Addr;                   /*!< Flash address of the next page to program */
+    const uint8_t *pu8Data;             /*!< Data of the next page to program */
+    uint32_t u32Remain;                 /*!< Bytes left to program */
+    uint8_t  u8State;                   /*!< Operation state */
+    uint8_t  u8XipOn;                   /*!< XIP mode was on when the operation started */
+} stc_qspi_flash_t;
+
 /**
  * @}
  */
@@ -373,6 +412,38 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup QSPI_Read_Profile QSPI Read Profile
+ * @{
+ */
+#ifndef QSPI_PROFILE_VERIFY_LOOP
+#define QSPI_PROFILE_VERIFY_LOOP                (4UL)   /*!< Times the pattern must be read back correctly */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup QSPI_Flash_Instruction QSPI Flash Instruction
+ * @{
+ */
+#define QSPI_FLASH_INSTR_WRITE_ENABLE           (0x06U)     /*!< Write enable                   */
+#define QSPI_FLASH_INSTR_READ_STATUS            (0x05U)     /*!< Read status register 1         */
+#define QSPI_FLASH_INSTR_PAGE_PROGRAM           (0x02U)     /*!< Page program                   */
+#define QSPI_FLASH_INSTR_SECTOR_ERASE           (0x20U)     /*!< 4KB sector erase               */
+#define QSPI_FLASH_INSTR_BLOCK_ERASE            (0xD8U)     /*!< 64KB block erase               */
+#define QSPI_FLASH_INSTR_CHIP_ERASE             (0xC7U)     /*!< Chip erase                     */
+#define QSPI_FLASH_INSTR_WRITE_DISABLE          (0x04U)     /*!< Write disable                  */
+#define QSPI_FLASH_INSTR_NONE                   (0x00U)     /*!< No instruction                 */
+
+#define QSPI_FLASH_STATUS_WIP                   (0x01U)     /*!< Write in progress bit of status register 1 */
+#define QSPI_FLASH_STATUS_WEL                   (0x02U)     /*!< Write enable latch bit of status register 1 */
+#define QSPI_FLASH_XIP_EXIT_CODE                (0xFFU)     /*!< Mode code to exit XIP mode     */
+#define QSPI_FLASH_NO_ADDR                      (0xFFFFFFFFUL)  /*!< The erase instruction takes no address */
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -409,6 +480,16 @@ void QSPI_SelectMemoryBlock(uint8_t u8Block);
 void QSPI_SetReadMode(uint32_t u32Mode);
 int32_t QSPI_CustomReadConfig(const stc_qspi_custom_mode_t *pstcCustomMode);
 void QSPI_XipModeCmd(uint8_t u8ModeCode, en_functional_state_t enNewState);
+int32_t QSPI_ReadProfile(uint32_t u32Addr, const uint8_t au8Pattern[], uint32_t u32Len,
+                         stc_qspi_read_profile_t *pstcProfile, uint32_t u32Num, uint32_t *pu32Best);
+
+/* Flash program and erase functions */
+int32_t QSPI_FlashStructInit(stc_qspi_flash_t *pstcFlash);
+int32_t QSPI_FlashInit(stc_qspi_flash_t *pstcFlash);
+int32_t QSPI_FlashProgramStart(stc_qspi_flash_t *pstcFlash, uint32_t u32Addr, const uint8_t au8Data[], uint32_t u32Len);
+int32_t QSPI_FlashEraseStart(stc_qspi_flash_t *pstcFlash, uint8_t u8Instr, uint32_t u32Addr);
+int32_t QSPI_FlashProcess(stc_qspi_flash_t *pstcFlash);
+int32_t QSPI_FlashWaitDone(stc_qspi_flash_t *pstcFlash, uint32_t u32Timeout);
 
 /* Transfer and receive data functions */
 void QSPI_EnterDirectCommMode(void);
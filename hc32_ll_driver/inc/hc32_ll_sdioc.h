@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add DMA multi-block transfer with scatter-gather descriptor chain
+   2026-10-18       CDT             Add word-wide FIFO copy for aligned buffers
+   2026-10-18       CDT             Add SD card bus width and high speed bring-up
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -34,6 +37,9 @@ extern "C"
 
 #include "hc32f4xx.h"
 #include "hc32f4xx_conf.h"
+#if (LL_DMA_ENABLE == DDL_ON)
+#include "hc32_ll_dma.h"
+#endif
 /**
  * @addtogroup LL_Driver
  * @{
@@ -103,6 +109,24 @@ typedef struct {
                                              This parameter can be a value of @ref SDIOC_Data_Timeout_Time */
 } stc_sdioc_data_config_t;
 
+/**
+ * @brief SDIOC DMA scatter-gather entry structure definition
+ */
+typedef struct {
+    uint32_t u32Addr;                   /*!< Specifies the word aligned buffer address. */
+    uint16_t u16BlockCount;             /*!< Specifies the data blocks moved to or from the buffer.
+                                             This parameter must be a number between Min_Data = 1 and Max_Data = 0xFFFF */
+} stc_sdioc_dma_sg_t;
+
+/**
+ * @brief SDMMC bus configuration structure definition
+ */
+typedef struct {
+    uint8_t  u8BusWidth;                /*!< Bus width, a value of @ref SDIOC_Bus_Width */
+    uint8_t  u8SpeedMode;               /*!< Speed mode, a value of @ref SDIOC_Speed_Mode */
+    uint16_t u16ClockDiv;               /*!< Clock division, a value of @ref SDIOC_Clock_Division */
+} stc_sdmmc_bus_config_t;
+
 /**
  * @brief SDIO CMD52 arguments structure definition
  */
@@ -812,6 +836,12 @@ int32_t SDIOC_ConfigData(CM_SDIOC_TypeDef *SDIOCx, const stc_sdioc_data_config_t
 int32_t SDIOC_DataStructInit(stc_sdioc_data_config_t *pstcDataConfig);
 int32_t SDIOC_ReadBuffer(CM_SDIOC_TypeDef *SDIOCx, uint8_t au8Data[], uint32_t u32Len);
 int32_t SDIOC_WriteBuffer(CM_SDIOC_TypeDef *SDIOCx, const uint8_t au8Data[], uint32_t u32Len);
+#if (LL_DMA_ENABLE == DDL_ON)
+int32_t SDIOC_DMA_DescInit(const CM_SDIOC_TypeDef *SDIOCx, uint16_t u16TransDir, uint16_t u16BlockSize,
+                           const stc_sdioc_dma_sg_t astcSg[], uint32_t u32Num, stc_dma_llp_descriptor_t astcDesc[]);
+int32_t SDIOC_DMA_Start(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_descriptor_t *pstcDesc);
+int32_t SDIOC_DMA_GetTransStatus(CM_SDIOC_TypeDef *SDIOCx, CM_DMA_TypeDef *DMAx, uint8_t u8Ch);
+#endif
 
 void SDIOC_BlockGapStopCmd(CM_SDIOC_TypeDef *SDIOCx, en_functional_state_t enNewState);
 void SDIOC_RestartTrans(CM_SDIOC_TypeDef *SDIOCx);
@@ -862,6 +892,8 @@ int32_t SDMMC_CMD52_IORwDirect(CM_SDIOC_TypeDef *SDIOCx, const stc_sdio_cmd52_ar
                                uint8_t u8In, uint8_t *pu8Out, uint32_t *pu32ErrStatus);
 int32_t SDMMC_CMD53_IORwExtended(CM_SDIOC_TypeDef *SDIOCx, const stc_sdio_cmd53_arg_t *pstcCmdArg,
                                  uint32_t *pu32ErrStatus);
+int32_t SDMMC_BusSpeedUp(CM_SDIOC_TypeDef *SDIOCx, uint32_t u32RCA, uint32_t u32TestAddr,
+                         stc_sdmmc_bus_config_t *pstcBusConfig, uint32_t *pu32ErrStatus);
 
 /**
  * @}
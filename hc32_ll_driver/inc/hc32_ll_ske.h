@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add key context API to reuse the expanded key
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -156,6 +157,37 @@ typedef struct {
     stc_ske_ccm_init_para_t *pstcCcmInit;   /*!< More initialization parameters for CCM mode. Set it to NULL if u32Mode is not SKE_MD_CCM */
 } stc_ske_init_t;
 
+/**
+ * @brief SKE key context structure.
+ * @note  The members are maintained by SKE_KeyCtxInit()/SKE_KeyCtxCrypto(), do not modify them directly.
+ */
+typedef struct {
+    uint32_t u32Alg;                        /*!< SKE algorithm.
+                                                 This parameter can be a value of @ref SKE_Algorithm */
+    uint32_t u32Crypto;                     /*!< Direction of the key schedule expanded by the context.
+                                                 This parameter can be a value of @ref SKE_Crypto_Action */
+    uint32_t au32Key[8U];                   /*!< Copy of the key, used to expand the key again when the other direction is needed. */
+} stc_ske_key_ctx_t;
+
+/**
+ * @brief SKE key context crypto structure.
+ */
+typedef struct {
+    uint32_t u32Mode;                       /*!< SKE operation mode.
+                                                 This parameter can be one of the following values:
+                                                 SKE_MD_ECB, SKE_MD_CBC, SKE_MD_CFB, SKE_MD_OFB, SKE_MD_CTR */
+    uint32_t u32Crypto;                     /*!< SKE crypto action.
+                                                 This parameter can be a value of @ref SKE_Crypto_Action */
+    uint8_t *pu8Iv;                         /*!< Pointer to IV buffer, its size is the block size of the algorithm.
+                                                 Set it to NULL for ECB mode. The chaining value of the next block is
+                                                 written back on return, so the following call can continue the stream. */
+    const uint8_t *pu8In;                   /*!< Pointer to the plaintext byte buffer if SKE encrypting.
+                                                 Pointer to the ciphertext byte buffer if SKE decrypting. */
+    uint8_t *pu8Out;                        /*!< Pointer to the ciphertext byte buffer if SKE encrypting.
+                                                 Pointer to the plaintext byte buffer if SKE decrypting. */
+    uint32_t u32CryptoSize;                 /*!< Size of the byte buffer that to be encrypted or decrypted */
+} stc_ske_key_ctx_crypto_t;
+
 /**
  * @}
  */
@@ -375,6 +407,11 @@ int32_t SKE_CmacAction(stc_ske_cmac_action_t *pstcAction);
 /* For GCM mode and CCM mode */
 int32_t SKE_XcmFinal(stc_ske_xcm_final_t *pstcFinal);
 
+/* Key context */
+int32_t SKE_KeyCtxInit(stc_ske_key_ctx_t *pstcCtx, uint32_t u32Alg, const uint8_t *pu8Key);
+int32_t SKE_KeyCtxDeInit(stc_ske_key_ctx_t *pstcCtx);
+int32_t SKE_KeyCtxCrypto(stc_ske_key_ctx_t *pstcCtx, stc_ske_key_ctx_crypto_t *pstcCrypto);
+
 /**
  * @}
  */
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add nanosecond timing conversion and memory test driven timing tuner
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -98,6 +99,19 @@ typedef struct {
                                      This parameter can be a value between Min_Data = 0 and Max_Data = 7 */
 } stc_exmc_smc_timing_config_t;
 
+/**
+ * @brief  EXMC_SMC Datasheet Timing Structure definition
+ * @note   The timings are the minimum values of the memory datasheet in nanoseconds.
+ */
+typedef struct {
+    uint32_t u32ReadCycle;      /*!< Read cycle time (tRC) */
+    uint32_t u32WriteCycle;     /*!< Write cycle time (tWC) */
+    uint32_t u32CeOeDelay;      /*!< Chip enable to output enable delay */
+    uint32_t u32WritePulse;     /*!< Write enable pulse width (tWP) */
+    uint32_t u32Turnaround;     /*!< Bus turnaround time between two accesses */
+    uint32_t u32AdvPulse;       /*!< Address valid pulse width */
+} stc_exmc_smc_timing_ns_t;
+
 /**
  * @brief  EXMC_SMC Initialization Structure definition
  */
@@ -249,6 +263,17 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup EXMC_SMC_Timing_Tune EXMC_SMC Timing Tune
+ * @{
+ */
+#ifndef EXMC_SMC_TUNE_MARGIN
+#define EXMC_SMC_TUNE_MARGIN                    (1U)    /*!< Cycles added back to the first failing timing */
+#endif
+/**
+ * @}
+ */
+
 /**
   * @brief  SMC device memory address shifting.
   * @param  [in] mem_base_addr          SMC base address
@@ -322,6 +347,10 @@ uint32_t EXMC_SMC_GetChipStartAddr(uint32_t u32Chip);
 uint32_t EXMC_SMC_GetChipEndAddr(uint32_t u32Chip);
 int32_t EXMC_SMC_GetChipConfig(uint32_t u32Chip, stc_exmc_smc_chip_config_t *pstcChipConfig);
 int32_t EXMC_SMC_GetTimingConfig(uint32_t u32Chip, stc_exmc_smc_timing_config_t *pstcTimingConfig);
+int32_t EXMC_SMC_CalcTiming(const stc_exmc_smc_timing_ns_t *pstcTimingNs, uint32_t u32ExclkFreq,
+                            stc_exmc_smc_timing_config_t *pstcTimingConfig);
+int32_t EXMC_SMC_TuneTiming(uint32_t u32Chip, uint32_t u32Addr, uint32_t u32Size,
+                            stc_exmc_smc_timing_config_t *pstcTimingConfig);
 
 /**
  * @}
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add entropy pool refilled by TRNG end interrupt
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -49,6 +50,26 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup TRNG_Global_Types TRNG Global Types
+ * @{
+ */
+
+/**
+ * @brief TRNG entropy pool structure
+ * @note  The members are maintained by the TRNG_Pool functions, do not modify them directly.
+ */
+typedef struct {
+    uint32_t *pu32Buf;                  /*!< Pointer to the ring buffer of random words. */
+    uint32_t u32Size;                   /*!< Size(in word) of the ring buffer, must be a power of 2 and not less than 2. */
+    __IO uint32_t u32WriteIdx;          /*!< Free running write index, updated by TRNG_PoolIrqHandler() only. */
+    __IO uint32_t u32ReadIdx;           /*!< Free running read index, updated by TRNG_PoolRead() only. */
+    __IO uint32_t u32Running;           /*!< Non-zero while TRNG is generating data for the pool. */
+} stc_trng_pool_t;
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -103,6 +124,11 @@ int32_t TRNG_GenerateRandom(uint32_t *pu32Random, uint32_t u32RandomLen);
 void TRNG_Start(void);
 void TRNG_Cmd(en_functional_state_t enNewState);
 int32_t TRNG_GetRandom(uint32_t *pu32Random, uint8_t u8RandomLen);
+
+int32_t TRNG_PoolInit(stc_trng_pool_t *pstcPool, uint32_t *pu32Buf, uint32_t u32Size);
+void TRNG_PoolIrqHandler(stc_trng_pool_t *pstcPool);
+int32_t TRNG_PoolRead(stc_trng_pool_t *pstcPool, uint32_t *pu32Random, uint32_t u32RandomLen);
+uint32_t TRNG_PoolGetCount(const stc_trng_pool_t *pstcPool);
 /**
  * @}
  */
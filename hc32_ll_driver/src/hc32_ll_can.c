@@ -6,6 +6,9 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add RX ring drained in ISR and acceptance filter planner
+   2026-10-18       CDT             Add TX priority scheduler on STB priority mode and PTB
+   2026-10-18       CDT             Add TTCAN schedule table engine
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -483,6 +486,202 @@ static void CAN_ReadRxBuf(const CM_CAN_TypeDef *CANx, stc_can_rx_frame_t *pstcRx
     }
 }
 
+/**
+ * @brief  Count the set bits of a value.
+ * @param  [in]  u32Value               The value.
+ * @retval Number of set bits.
+ */
+static uint32_t CAN_BitCount(uint32_t u32Value)
+{
+    uint32_t u32Count = 0UL;
+
+    while (u32Value != 0UL) {
+        u32Value &= (u32Value - 1UL);
+        u32Count++;
+    }
+    return u32Count;
+}
+
+/**
+ * @brief  Reduce the acceptance filters without accepting more IDs.
+ * @param  [in,out] astcFilter          Pointer to a stc_can_filter_config_t structure type array.
+ * @param  [in,out] pu32Num             Number of the filters in the array.
+ * @retval None
+ * @note   A filter that is covered by another one is removed, and two filters with the same mask whose
+ *         IDs differ in one bit only are merged into one with that bit masked.
+ */
+static void CAN_FilterReduce(stc_can_filter_config_t astcFilter[], uint32_t *pu32Num)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t u32Diff;
+    uint32_t u32Changed;
+
+    do {
+        u32Changed = 0UL;
+        for (i = 0UL; i < *pu32Num; i++) {
+            j = 0UL;
+            while (j < *pu32Num) {
+                u32Diff = (astcFilter[i].u32ID ^ astcFilter[j].u32ID) & ~astcFilter[i].u32IDMask;
+                if ((i != j) && ((astcFilter[j].u32IDMask | astcFilter[i].u32IDMask) == astcFilter[i].u32IDMask) &&
+                    ((u32Diff == 0UL) ||
+                     ((astcFilter[j].u32IDMask == astcFilter[i].u32IDMask) && ((u32Diff & (u32Diff - 1UL)) == 0UL)))) {
+                    /* j is covered by i, or i and j together cover i with one more bit masked */
+                    astcFilter[i].u32IDMask |= u32Diff;
+                    astcFilter[i].u32ID &= ~u32Diff;
+                    (*pu32Num)--;
+                    astcFilter[j] = astcFilter[*pu32Num];
+                    if (*pu32Num == i) {
+                        /* i was the last one and is moved to j */
+                        i = j;
+                    }
+                    u32Changed = 1UL;
+                } else {
+                    j++;
+                }
+            }
+        }
+    } while (u32Changed != 0UL);
+}
+
+/**
+ * @brief  Compare two queued TX entries.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @param  [in]  u32A                   Heap position of the first entry.
+ * @param  [in]  u32B                   Heap position of the second entry.
+ * @retval 1 if the first entry is sent before the second one, otherwise 0.
+ */
+static uint32_t CAN_TxSchedBefore(const stc_can_tx_sched_t *pstcSched, uint32_t u32A, uint32_t u32B)
+{
+    const stc_can_tx_entry_t *pstcA = &pstcSched->pstcEntry[pstcSched->pu16Index[u32A]];
+    const stc_can_tx_entry_t *pstcB = &pstcSched->pstcEntry[pstcSched->pu16Index[u32B]];
+
+    if (pstcA->u32Key != pstcB->u32Key) {
+        return (pstcA->u32Key < pstcB->u32Key) ? 1UL : 0UL;
+    }
+    /* Same key, first in first out */
+    return ((int32_t)(pstcA->u32Seq - pstcB->u32Seq) < 0) ? 1UL : 0UL;
+}
+
+/**
+ * @brief  Swap two heap positions of the TX queue.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @param  [in]  u32A                   Heap position.
+ * @param  [in]  u32B                   Heap position.
+ * @retval None
+ */
+static void CAN_TxSchedSwap(stc_can_tx_sched_t *pstcSched, uint32_t u32A, uint32_t u32B)
+{
+    uint16_t u16Tmp = pstcSched->pu16Index[u32A];
+
+    pstcSched->pu16Index[u32A] = pstcSched->pu16Index[u32B];
+    pstcSched->pu16Index[u32B] = u16Tmp;
+}
+
+/**
+ * @brief  Remove the first frame of the TX queue.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @retval None
+ * @note   The entry index of the removed frame goes to the free part of the index array.
+ */
+static void CAN_TxSchedPop(stc_can_tx_sched_t *pstcSched)
+{
+    uint32_t u32Pos = 0UL;
+    uint32_t u32Child;
+
+    pstcSched->u16Count--;
+    CAN_TxSchedSwap(pstcSched, 0UL, pstcSched->u16Count);
+    for (;;) {
+        u32Child = (u32Pos * 2UL) + 1UL;
+        if (u32Child >= pstcSched->u16Count) {
+            break;
+        }
+        if (((u32Child + 1UL) < pstcSched->u16Count) && (CAN_TxSchedBefore(pstcSched, u32Child + 1UL, u32Child) != 0UL)) {
+            u32Child++;
+        }
+        if (CAN_TxSchedBefore(pstcSched, u32Child, u32Pos) == 0UL) {
+            break;
+        }
+        CAN_TxSchedSwap(pstcSched, u32Pos, u32Child);
+        u32Pos = u32Child;
+    }
+}
+
+/**
+ * @brief  Move the queued frames to the free transmit buffers and start the transmission.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @retval None
+ * @note   Frames less than u32UrgentKey take PTB, which is sent before STB. The other frames, and the urgent
+ *         frames while PTB is busy, take STB up to u8StbDepth frames. STB is sent one frame at a time in
+ *         priority mode, so each STB transmit complete interrupt can refill it.
+ */
+static void CAN_TxSchedDispatch(stc_can_tx_sched_t *pstcSched)
+{
+    CM_CAN_TypeDef *CANx = pstcSched->CANx;
+    const stc_can_tx_entry_t *pstcEntry;
+
+    while (pstcSched->u16Count > 0U) {
+        pstcEntry = &pstcSched->pstcEntry[pstcSched->pu16Index[0U]];
+        if ((pstcEntry->u32Key < pstcSched->u32UrgentKey) && (pstcSched->u8PtbBusy == 0U)) {
+            if (CAN_FillTxFrame(CANx, CAN_TX_BUF_PTB, &pstcEntry->stcFrame) != LL_OK) {
+                break;
+            }
+            CAN_StartTx(CANx, CAN_TX_REQ_PTB);
+            pstcSched->u8PtbBusy = 1U;
+        } else if (pstcSched->u8StbCount < pstcSched->u8StbDepth) {
+            if (CAN_FillTxFrame(CANx, CAN_TX_BUF_STB, &pstcEntry->stcFrame) != LL_OK) {
+                break;
+            }
+            pstcSched->u8StbCount++;
+        } else {
+            break;
+        }
+        CAN_TxSchedPop(pstcSched);
+    }
+
+    if ((pstcSched->u8StbCount > 0U) && (READ_REG8_BIT(CANx->TCMD, CAN_TCMD_TSONE | CAN_TCMD_TSALL) == 0U)) {
+        CAN_StartTx(CANx, CAN_TX_REQ_STB_ONE);
+    }
+}
+
+/**
+ * @brief  Load the next slot of the current basic cycle to the TTCAN trigger.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @retval None
+ * @note   The frame of a transmission slot is written to the next of the PTB and STB slots in turn, so the
+ *         buffer of the frame being sent is not touched. Writing TT_TRIG arms the trigger.
+ */
+static void CAN_TTC_SchedLoad(stc_can_ttc_sched_t *pstcSched)
+{
+    CM_CAN_TypeDef *CANx = pstcSched->CANx;
+    const stc_can_ttc_slot_t *pstcSlot;
+
+    pstcSched->u8Armed = 0U;
+    while (pstcSched->u16NextSlot < pstcSched->u16SlotNum) {
+        pstcSlot = &pstcSched->pstcSlot[pstcSched->u16NextSlot];
+        pstcSched->u16NextSlot++;
+        if ((pstcSched->u8CycleCount & (pstcSlot->u8RepeatFactor - 1U)) != pstcSlot->u8BaseCycle) {
+            continue;
+        }
+
+        if (pstcSlot->pstcTx != NULL) {
+            /* Drop a frame left in the buffer since its last use */
+            WRITE_REG8(CANx->TBSLOT, pstcSched->u8TxBuf);
+            SET_REG8_BIT(CANx->TBSLOT, CAN_TBSLOT_TBE);
+            CAN_WriteTxBuf(CANx, pstcSlot->pstcTx);
+            SET_REG8_BIT(CANx->TBSLOT, CAN_TBSLOT_TBF);
+            MODIFY_REG16(CANx->TRG_CFG, CAN_TRG_CFG_TTPTR | CAN_TRG_CFG_TTYPE,
+                         (uint16_t)pstcSched->u8TxBuf | pstcSlot->u16TriggerType);
+            pstcSched->u8TxBuf = (pstcSched->u8TxBuf + 1U) % (CAN_STB_SLOT_NUM + 1U);
+        } else {
+            MODIFY_REG16(CANx->TRG_CFG, CAN_TRG_CFG_TTYPE, pstcSlot->u16TriggerType);
+        }
+        WRITE_REG16(CANx->TT_TRIG, pstcSlot->u16TriggerTime);
+        pstcSched->u8Armed = 1U;
+        break;
+    }
+}
+
 /**
  * @}
  */
@@ -1137,6 +1336,367 @@ void CAN_FilterCmd(CM_CAN_TypeDef *CANx, uint16_t u16FilterSelect, en_functional
     }
 }
 
+/**
+ * @brief  Plan the fewest acceptance filters that accept the given IDs.
+ * @param  [in]  au32ID                 The IDs the application receives.
+ * @param  [in]  u32IdNum               Number of the IDs.
+ * @param  [in]  u32IDType              The ID type of all the IDs.
+ *                                      This parameter can be a value of @ref CAN_ID_Type
+ * @param  [out] astcFilter             Pointer to a stc_can_filter_config_t structure type array of u32IdNum
+ *                                      elements. The planned filters are put at the front of the array.
+ * @param  [in]  u32FilterMax           The number of acceptance filters that can be used, [1, CAN_FILTER_NUM].
+ * @param  [out] pu16FilterSelect       The filters to be enabled. This value can be values of @ref CAN_Acceptance_Filter
+ * @retval int32_t:
+ *           - LL_OK:                   The filters accept exactly the given IDs.
+ *           - LL_ERR:                  The IDs need more than u32FilterMax filters, the planned filters also
+ *                                      accept some other IDs.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL, a number is out of range or an ID is too long for the ID type.
+ * @note   1) The IDs are first merged into filters without accepting any other ID. While there are more than
+ *            u32FilterMax filters, the two filters whose merge accepts the fewest other IDs are merged.
+ *         2) Set stc_can_init_t::pstcFilter to astcFilter and stc_can_init_t::u16FilterSelect to
+ *            *pu16FilterSelect before CAN_Init().
+ */
+int32_t CAN_FilterPlan(const uint32_t au32ID[], uint32_t u32IdNum, uint32_t u32IDType,
+                       stc_can_filter_config_t astcFilter[], uint32_t u32FilterMax, uint16_t *pu16FilterSelect)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t u32Num = 0UL;
+    uint32_t u32Mask;
+    uint32_t u32Cost;
+    uint32_t u32BestCost;
+    uint32_t u32BestI = 0UL;
+    uint32_t u32BestJ = 0UL;
+    int32_t i32Ret = LL_OK;
+    const uint32_t u32IdBits = (u32IDType == CAN_ID_STD) ? CAN_STD_ID_MASK : CAN_EXT_ID_MASK;
+
+    if ((au32ID == NULL) || (astcFilter == NULL) || (pu16FilterSelect == NULL) || (u32IdNum == 0UL) ||
+        (u32FilterMax == 0UL) || (u32FilterMax > CAN_FILTER_NUM) || (!IS_CAN_ID_TYPE(u32IDType))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    for (i = 0UL; i < u32IdNum; i++) {
+        if ((au32ID[i] & ~u32IdBits) != 0UL) {
+            return LL_ERR_INVD_PARAM;
+        }
+        astcFilter[i].u32ID = au32ID[i];
+        astcFilter[i].u32IDMask = 0UL;
+        astcFilter[i].u32IDType = u32IDType;
+    }
+    u32Num = u32IdNum;
+    CAN_FilterReduce(astcFilter, &u32Num);
+
+    while (u32Num > u32FilterMax) {
+        i32Ret = LL_ERR;
+        u32BestCost = 0xFFFFFFFFUL;
+        for (i = 0UL; i < u32Num; i++) {
+            for (j = i + 1UL; j < u32Num; j++) {
+                u32Mask = astcFilter[i].u32IDMask | astcFilter[j].u32IDMask | \
+                          (astcFilter[i].u32ID ^ astcFilter[j].u32ID);
+                /* The IDs accepted by the merged filter but by neither of the two, roughly */
+                u32Cost = (1UL << CAN_BitCount(u32Mask)) - \
+                          (1UL << LL_MAX(CAN_BitCount(astcFilter[i].u32IDMask), CAN_BitCount(astcFilter[j].u32IDMask)));
+                if (u32Cost < u32BestCost) {
+                    u32BestCost = u32Cost;
+                    u32BestI = i;
+                    u32BestJ = j;
+                }
+            }
+        }
+        u32Mask = astcFilter[u32BestI].u32IDMask | astcFilter[u32BestJ].u32IDMask | \
+                  (astcFilter[u32BestI].u32ID ^ astcFilter[u32BestJ].u32ID);
+        astcFilter[u32BestI].u32IDMask = u32Mask;
+        astcFilter[u32BestI].u32ID &= ~u32Mask;
+        u32Num--;
+        astcFilter[u32BestJ] = astcFilter[u32Num];
+        CAN_FilterReduce(astcFilter, &u32Num);
+    }
+
+    *pu16FilterSelect = (uint16_t)((1UL << u32Num) - 1UL);
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a CAN RX ring.
+ * @param  [out] pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @param  [in]  pstcEntry              Entry buffer of the ring.
+ * @param  [in]  u32Size                Number of entries in the buffer, a power of 2.
+ * @param  [in]  pfnGetTimestamp        Timestamp source called for each received frame. Can be NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or u32Size is not a power of 2.
+ * @note   Enable the interrupt CAN_INT_RX and call CAN_RxRingIrqHandler() in the CAN ISR.
+ */
+int32_t CAN_RxRingInit(stc_can_rx_ring_t *pstcRing, stc_can_rx_entry_t *pstcEntry, uint32_t u32Size,
+                       uint32_t (*pfnGetTimestamp)(void))
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcRing != NULL) && (pstcEntry != NULL) && (u32Size != 0UL) && ((u32Size & (u32Size - 1UL)) == 0UL)) {
+        pstcRing->pstcEntry = pstcEntry;
+        pstcRing->u32Size = u32Size;
+        pstcRing->pfnGetTimestamp = pfnGetTimestamp;
+        pstcRing->u32Head = 0UL;
+        pstcRing->u32Tail = 0UL;
+        pstcRing->u32Overrun = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Move all the frames in the receive buffer to the RX ring.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @param  [in]  pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @retval Number of frames moved to the ring.
+ * @note   Call it in the CAN ISR. The receive flags are cleared before the receive buffer is drained.
+ *         A frame is dropped and counted in u32Overrun if the ring is full.
+ */
+uint32_t CAN_RxRingIrqHandler(CM_CAN_TypeDef *CANx, stc_can_rx_ring_t *pstcRing)
+{
+    uint32_t u32Head;
+    uint32_t u32Count = 0UL;
+    stc_can_rx_entry_t *pstcEntry;
+
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+
+    if (pstcRing == NULL) {
+        return 0UL;
+    }
+
+    CAN_ClearStatus(CANx, CAN_FLAG_RX | CAN_FLAG_RX_BUF_WARN | CAN_FLAG_RX_BUF_FULL | CAN_FLAG_RX_OVERRUN);
+    u32Head = pstcRing->u32Head;
+    while (READ_REG8_BIT(CANx->RCTRL, CAN_RCTRL_RSTAT) != CAN_RX_BUF_EMPTY) {
+        if ((u32Head - pstcRing->u32Tail) < pstcRing->u32Size) {
+            pstcEntry = &pstcRing->pstcEntry[u32Head & (pstcRing->u32Size - 1UL)];
+            CAN_ReadRxBuf(CANx, &pstcEntry->stcFrame);
+            pstcEntry->u32Timestamp = (pstcRing->pfnGetTimestamp != NULL) ? pstcRing->pfnGetTimestamp() : 0UL;
+            u32Head++;
+            u32Count++;
+        } else {
+            pstcRing->u32Overrun++;
+        }
+        /* Set RB to point to the next RB slot. */
+        SET_REG8_BIT(CANx->RCTRL, CAN_RCTRL_RREL);
+    }
+    /* The entries are written before they are published to the reader */
+    __DMB();
+    pstcRing->u32Head = u32Head;
+
+    return u32Count;
+}
+
+/**
+ * @brief  Get the oldest frame from the RX ring.
+ * @param  [in]  pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @param  [out] pstcEntry              Pointer to a @ref stc_can_rx_entry_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Get one frame successfully.
+ *           - LL_ERR_BUF_EMPTY:        The ring is empty.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL.
+ */
+int32_t CAN_RxRingGet(stc_can_rx_ring_t *pstcRing, stc_can_rx_entry_t *pstcEntry)
+{
+    uint32_t u32Tail;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcRing != NULL) && (pstcEntry != NULL)) {
+        u32Tail = pstcRing->u32Tail;
+        if (u32Tail == pstcRing->u32Head) {
+            i32Ret = LL_ERR_BUF_EMPTY;
+        } else {
+            *pstcEntry = pstcRing->pstcEntry[u32Tail & (pstcRing->u32Size - 1UL)];
+            /* The entry is copied before it is given back to the writer */
+            __DMB();
+            pstcRing->u32Tail = u32Tail + 1UL;
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the number of frames in the RX ring.
+ * @param  [in]  pstcRing               Pointer to a @ref stc_can_rx_ring_t structure.
+ * @retval Number of frames.
+ */
+uint32_t CAN_RxRingGetCount(const stc_can_rx_ring_t *pstcRing)
+{
+    uint32_t u32Count = 0UL;
+
+    if (pstcRing != NULL) {
+        u32Count = pstcRing->u32Head - pstcRing->u32Tail;
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Initialize a CAN TX priority scheduler.
+ * @param  [out] pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @param  [in]  pstcEntry              Entry buffer of the queue.
+ * @param  [in]  pu16Index              Entry index array of u16Size elements.
+ * @param  [in]  u16Size                Number of entries.
+ * @param  [in]  u32UrgentKey           Frames whose CAN_TX_SCHED_KEY() is less than it are urgent frames.
+ *                                      0 means no urgent frame and PTB is not used.
+ * @param  [in]  u8StbDepth             Maximum number of frames in STB, [1, CAN_STB_SLOT_NUM].
+ *                                      A smaller value keeps fewer low priority frames ahead of a new frame.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or a number is out of range.
+ *           - LL_ERR:                  The STB priority mode is not enabled.
+ * @note   1) Initialize CAN with u8STBPrioMode = CAN_STB_PRIO_MD_ENABLE first. The scheduler owns the
+ *            transmit buffers, do not call CAN_FillTxFrame() or CAN_StartTx() beside it.
+ *         2) The interrupts CAN_INT_STB_TX and CAN_INT_PTB_TX are enabled, call CAN_TxSchedIrqHandler()
+ *            in the CAN ISR.
+ */
+int32_t CAN_TxSchedInit(stc_can_tx_sched_t *pstcSched, CM_CAN_TypeDef *CANx, stc_can_tx_entry_t *pstcEntry,
+                        uint16_t *pu16Index, uint16_t u16Size, uint32_t u32UrgentKey, uint8_t u8StbDepth)
+{
+    uint16_t i;
+
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+
+    if ((pstcSched == NULL) || (pstcEntry == NULL) || (pu16Index == NULL) || (u16Size == 0U) ||
+        (u8StbDepth == 0U) || (u8StbDepth > CAN_STB_SLOT_NUM)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (READ_REG8_BIT(CANx->TCTRL, CAN_TCTRL_TSMODE) != CAN_STB_PRIO_MD_ENABLE) {
+        return LL_ERR;
+    }
+
+    pstcSched->CANx = CANx;
+    pstcSched->pstcEntry = pstcEntry;
+    pstcSched->pu16Index = pu16Index;
+    pstcSched->u16Size = u16Size;
+    pstcSched->u16Count = 0U;
+    pstcSched->u32Seq = 0UL;
+    pstcSched->u32UrgentKey = u32UrgentKey;
+    pstcSched->u8StbDepth = u8StbDepth;
+    pstcSched->u8StbCount = 0U;
+    pstcSched->u8PtbBusy = 0U;
+    for (i = 0U; i < u16Size; i++) {
+        pu16Index[i] = i;
+    }
+
+    CAN_ClearStatus(CANx, CAN_FLAG_STB_TX | CAN_FLAG_PTB_TX);
+    CAN_IntCmd(CANx, CAN_INT_STB_TX | CAN_INT_PTB_TX, ENABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Queue a frame to the CAN TX priority scheduler.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @param  [in]  pstcTx                 Pointer to a @ref stc_can_tx_frame_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   The frame is queued, or is already in a transmit buffer.
+ *           - LL_ERR_BUF_FULL:         The queue is full.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL.
+ * @note   The frames are sent in the order of the bus arbitration, frames with the same ID in the order
+ *         they are queued. The interrupts CAN_INT_STB_TX and CAN_INT_PTB_TX are masked while the queue
+ *         is changed.
+ */
+int32_t CAN_TxSchedPut(stc_can_tx_sched_t *pstcSched, const stc_can_tx_frame_t *pstcTx)
+{
+    uint32_t u32Pos;
+    uint32_t u32Parent;
+    stc_can_tx_entry_t *pstcEntry;
+    int32_t i32Ret = LL_OK;
+
+    if ((pstcSched == NULL) || (pstcTx == NULL)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    /* Only RTIE is touched, ERRINT holds write-1-to-clear flags */
+    CLR_REG8_BIT(pstcSched->CANx->RTIE, CAN_RTIE_TSIE | CAN_RTIE_TPIE);
+    if (pstcSched->u16Count >= pstcSched->u16Size) {
+        i32Ret = LL_ERR_BUF_FULL;
+    } else {
+        u32Pos = pstcSched->u16Count;
+        pstcEntry = &pstcSched->pstcEntry[pstcSched->pu16Index[u32Pos]];
+        pstcEntry->stcFrame = *pstcTx;
+        pstcEntry->u32Key = CAN_TX_SCHED_KEY(pstcTx->IDE, pstcTx->u32ID);
+        pstcEntry->u32Seq = pstcSched->u32Seq++;
+        pstcSched->u16Count++;
+        while (u32Pos > 0UL) {
+            u32Parent = (u32Pos - 1UL) / 2UL;
+            if (CAN_TxSchedBefore(pstcSched, u32Pos, u32Parent) == 0UL) {
+                break;
+            }
+            CAN_TxSchedSwap(pstcSched, u32Pos, u32Parent);
+            u32Pos = u32Parent;
+        }
+        CAN_TxSchedDispatch(pstcSched);
+    }
+    SET_REG8_BIT(pstcSched->CANx->RTIE, CAN_RTIE_TSIE | CAN_RTIE_TPIE);
+
+    return i32Ret;
+}
+
+/**
+ * @brief  CAN TX priority scheduler interrupt handler.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @retval None
+ * @note   Call it in the CAN ISR. It handles and clears the flags CAN_FLAG_STB_TX and CAN_FLAG_PTB_TX.
+ *         After an abort or bus off the transmit buffers are checked again, enable CAN_INT_ERR_INT to
+ *         get the bus off event. The flag CAN_FLAG_TX_ABORTED is left to the application.
+ */
+void CAN_TxSchedIrqHandler(stc_can_tx_sched_t *pstcSched)
+{
+    CM_CAN_TypeDef *CANx;
+
+    if (pstcSched == NULL) {
+        return;
+    }
+
+    CANx = pstcSched->CANx;
+    if (CAN_GetStatus(CANx, CAN_FLAG_PTB_TX) == SET) {
+        CAN_ClearStatus(CANx, CAN_FLAG_PTB_TX);
+        pstcSched->u8PtbBusy = 0U;
+    }
+    if (CAN_GetStatus(CANx, CAN_FLAG_STB_TX) == SET) {
+        CAN_ClearStatus(CANx, CAN_FLAG_STB_TX);
+        if (pstcSched->u8StbCount > 0U) {
+            pstcSched->u8StbCount--;
+        }
+    }
+    /* An aborted frame, or a frame dropped by bus off, never sets the transmit complete flags */
+    if ((CAN_GetStatus(CANx, CAN_FLAG_TX_ABORTED) == SET) || (CAN_GetStatus(CANx, CAN_FLAG_BUS_OFF) == SET)) {
+        if (READ_REG8_BIT(CANx->TCMD, CAN_TCMD_TPE) == 0U) {
+            pstcSched->u8PtbBusy = 0U;
+        }
+        if (READ_REG8_BIT(CANx->TCTRL, CAN_TCTRL_TSSTAT) == 0U) {
+            pstcSched->u8StbCount = 0U;
+        }
+    }
+    CAN_TxSchedDispatch(pstcSched);
+}
+
+/**
+ * @brief  Get the number of frames waiting in the CAN TX priority scheduler queue.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_tx_sched_t structure.
+ * @retval Number of frames, not including the frames in the transmit buffers.
+ */
+uint32_t CAN_TxSchedGetCount(const stc_can_tx_sched_t *pstcSched)
+{
+    uint32_t u32Count = 0UL;
+
+    if (pstcSched != NULL) {
+        u32Count = pstcSched->u16Count;
+    }
+
+    return u32Count;
+}
+
 /**
  * @brief  Set receive buffer full warning limit.
  * @param  [in]  CANx                   Pointer to CAN instance register base.
@@ -1559,6 +2119,122 @@ int32_t CAN_TTC_GetConfig(const CM_CAN_TypeDef *CANx, stc_can_ttc_config_t *pstc
     return i32Ret;
 }
 
+/**
+ * @brief  Initialize a TTCAN schedule table engine with the system matrix of the node.
+ * @param  [out] pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @param  [in]  CANx                   Pointer to CAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_CAN or CM_CANx:           CAN instance register base.
+ * @param  [in]  pstcSlot               Pointer to a @ref stc_can_ttc_slot_t structure type array, the slots of
+ *                                      the node in increasing trigger time.
+ * @param  [in]  u16SlotNum             Number of slots.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL, the slots are not in increasing trigger time, or a slot
+ *                                      has an invalid cycle setting or a CAN FD frame.
+ *           - LL_ERR:                  TTCAN is not configured with CAN_TTC_TX_BUF_MD_TTCAN.
+ * @note   1) Configure TTCAN by CAN_Init() with u8TxBufMode = CAN_TTC_TX_BUF_MD_TTCAN and enable it by CAN_TTC_Cmd().
+ *         2) The interrupts CAN_TTC_INT_TIME_TRIG and CAN_TTC_INT_WATCH_TRIG are enabled, call
+ *            CAN_TTC_SchedIrqHandler() in the CAN ISR.
+ *         3) The engine starts at the first call of CAN_TTC_SchedRefMsgHandler().
+ */
+int32_t CAN_TTC_SchedInit(stc_can_ttc_sched_t *pstcSched, CM_CAN_TypeDef *CANx,
+                          const stc_can_ttc_slot_t *pstcSlot, uint16_t u16SlotNum)
+{
+    uint16_t i;
+    uint8_t u8Repeat;
+
+    DDL_ASSERT(IS_CAN_UNIT(CANx));
+
+    if ((pstcSched == NULL) || (pstcSlot == NULL) || (u16SlotNum == 0U)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    for (i = 0U; i < u16SlotNum; i++) {
+        u8Repeat = pstcSlot[i].u8RepeatFactor;
+        if ((u8Repeat == 0U) || (u8Repeat > CAN_TTC_CYCLE_NUM_MAX) || ((u8Repeat & (u8Repeat - 1U)) != 0U) ||
+            (pstcSlot[i].u8BaseCycle >= u8Repeat) || (!IS_TTCAN_TRIG_TYPE(pstcSlot[i].u16TriggerType)) ||
+            ((i > 0U) && (pstcSlot[i].u16TriggerTime <= pstcSlot[i - 1U].u16TriggerTime)) ||
+            ((pstcSlot[i].pstcTx != NULL) && (pstcSlot[i].pstcTx->FDF != 0U))) {
+            return LL_ERR_INVD_PARAM;
+        }
+    }
+    if (READ_REG8_BIT(CANx->TCTRL, CAN_TCTRL_TTTBM) != CAN_TTC_TX_BUF_MD_TTCAN) {
+        return LL_ERR;
+    }
+
+    pstcSched->CANx = CANx;
+    pstcSched->pstcSlot = pstcSlot;
+    pstcSched->u16SlotNum = u16SlotNum;
+    pstcSched->u16NextSlot = u16SlotNum;
+    pstcSched->u8CycleCount = 0U;
+    pstcSched->u8TxBuf = CAN_TTC_TX_BUF_PTB;
+    pstcSched->u8Armed = 0U;
+    pstcSched->u8TrigErr = 0U;
+    pstcSched->u32TrigErrCount = 0UL;
+    pstcSched->u32WatchTrigCount = 0UL;
+
+    CAN_TTC_ClearStatus(CANx, CAN_TTC_FLAG_TIME_TRIG | CAN_TTC_FLAG_WATCH_TRIG);
+    CAN_TTC_IntCmd(CANx, CAN_TTC_INT_TIME_TRIG | CAN_TTC_INT_WATCH_TRIG, ENABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Start a basic cycle of the TTCAN schedule table engine.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @param  [in]  u8CycleCount           The cycle count of the reference message, bits[5:0] of its first data byte.
+ * @retval None
+ * @note   Call it when a reference message is received, or sent by the time master. The first slot of the
+ *         basic cycle is loaded, the other slots are loaded by CAN_TTC_SchedIrqHandler().
+ */
+void CAN_TTC_SchedRefMsgHandler(stc_can_ttc_sched_t *pstcSched, uint8_t u8CycleCount)
+{
+    if (pstcSched != NULL) {
+        pstcSched->u8CycleCount = u8CycleCount & (CAN_TTC_CYCLE_NUM_MAX - 1U);
+        pstcSched->u16NextSlot = 0U;
+        CAN_TTC_SchedLoad(pstcSched);
+    }
+}
+
+/**
+ * @brief  TTCAN schedule table engine interrupt handler.
+ * @param  [in]  pstcSched              Pointer to a @ref stc_can_ttc_sched_t structure.
+ * @retval None
+ * @note   Call it in the CAN ISR. On a time trigger the next slot of the basic cycle is loaded. A watch trigger
+ *         stops the engine until the next reference message. A trigger error is counted once when TEIF is set.
+ */
+void CAN_TTC_SchedIrqHandler(stc_can_ttc_sched_t *pstcSched)
+{
+    CM_CAN_TypeDef *CANx;
+
+    if (pstcSched == NULL) {
+        return;
+    }
+
+    CANx = pstcSched->CANx;
+    /* TEIF is cleared by hardware only and the ISR is shared, count the rising edges of it. */
+    if (CAN_TTC_GetStatus(CANx, CAN_TTC_FLAG_TRIG_ERR) == SET) {
+        if (pstcSched->u8TrigErr == 0U) {
+            pstcSched->u32TrigErrCount++;
+        }
+        pstcSched->u8TrigErr = 1U;
+    } else {
+        pstcSched->u8TrigErr = 0U;
+    }
+    if (CAN_TTC_GetStatus(CANx, CAN_TTC_FLAG_WATCH_TRIG) == SET) {
+        CAN_TTC_ClearStatus(CANx, CAN_TTC_FLAG_WATCH_TRIG);
+        pstcSched->u32WatchTrigCount++;
+        pstcSched->u16NextSlot = pstcSched->u16SlotNum;
+        pstcSched->u8Armed = 0U;
+    }
+    if (CAN_TTC_GetStatus(CANx, CAN_TTC_FLAG_TIME_TRIG) == SET) {
+        CAN_TTC_ClearStatus(CANx, CAN_TTC_FLAG_TIME_TRIG);
+        if (pstcSched->u8Armed != 0U) {
+            CAN_TTC_SchedLoad(pstcSched);
+        }
+    }
+}
+
 /**
  * @brief  Specifies ECC mode of the CAN RAM.
  * @param  [in]  CANx                   Pointer to CAN instance register base.
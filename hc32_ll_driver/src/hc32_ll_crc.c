@@ -8,6 +8,9 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-11-08       CDT             Modify interface of AccumulateData and Calculate functions
+   2026-10-18       CDT             Add CRC byte stream API with word write for aligned data
+   2026-10-18       CDT             Add CRC calculation fed by DMA
+   2026-10-18       CDT             Add CRC context to share the CRC unit between streams
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -25,6 +28,9 @@
  ******************************************************************************/
 #include "hc32_ll_crc.h"
 #include "hc32_ll_utility.h"
+#if (LL_DMA_ENABLE == DDL_ON)
+#include "hc32_ll_dma.h"
+#endif
 
 /**
  * @addtogroup LL_Driver
@@ -99,6 +105,37 @@
 
 #define CRC_RMU_TIMEOUT                 (100U)
 
+/**
+ * @defgroup CRC_Ctx CRC Context
+ * @{
+ */
+/* Write the state of the context loaded in the CRC unit back to it before the unit is reconfigured */
+#define CRC_CTX_SAVE()                                                         \
+do {                                                                           \
+    if (m_pstcCrcResidentCtx != NULL) {                                        \
+        m_pstcCrcResidentCtx->u64Value = CRC_GetResult();                      \
+        m_pstcCrcResidentCtx = NULL;                                           \
+    }                                                                          \
+} while (0)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CRC_Byte_Stream CRC Byte Stream
+ * @{
+ */
+/* Reflected protocols consume a 32-bit write LSB first, i.e. in memory byte order on little-endian. */
+#define CRC_IS_WORD_IN_BYTE_ORDER(x)                                           \
+(   ((x) != CRC_CRC16_CCITT_FALSE)      &&                                     \
+    ((x) != CRC_CRC16_XMODE)            &&                                     \
+    ((x) != CRC_CRC32_MPEG2))
+
+#define CRC_WORD_ALIGN_MASK             (3UL)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -114,6 +151,8 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* The context whose state is currently held in the CRC unit */
+static stc_crc_ctx_t *m_pstcCrcResidentCtx = NULL;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -168,6 +207,60 @@ static void CRC_WriteData32(const uint32_t au32Data[], uint32_t u32Len)
     }
 }
 
+/**
+ * @brief  Write a byte stream to the CRC data register.
+ * @param  [in] pu8Data                 Pointer to the input data buffer, no alignment required.
+ * @param  [in] u32Len                  The length(counted in byte) of the data to be calculated.
+ * @retval None
+ * @note   For the reflected protocols the unaligned head and tail are written in byte and the
+ *         aligned middle in word, which gives the same result as writing every byte. The other
+ *         protocols are always written in byte.
+ */
+static void CRC_WriteStream(const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t u32Head;
+    uint32_t u32Words;
+    uint32_t u32Protocol = READ_REG32_BIT(CM_CRC->CR, CRC_CR_SELECT | CRC_CR_CR);
+
+    if (CRC_IS_WORD_IN_BYTE_ORDER(u32Protocol)) {
+        /* Bytes up to the first word boundary */
+        u32Head = (4UL - ((uint32_t)pu8Data & CRC_WORD_ALIGN_MASK)) & CRC_WORD_ALIGN_MASK;
+        u32Head = LL_MIN(u32Head, u32Len);
+        CRC_WriteData8(pu8Data, u32Head);
+        pu8Data = &pu8Data[u32Head];
+        u32Len -= u32Head;
+
+        /* Aligned words */
+        u32Words = u32Len >> 2U;
+        CRC_WriteData32((const uint32_t *)((const void *)pu8Data), u32Words);
+        pu8Data = &pu8Data[u32Words << 2U];
+        u32Len &= CRC_WORD_ALIGN_MASK;
+    }
+
+    CRC_WriteData8(pu8Data, u32Len);
+}
+
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Start the DMA request for the next chunk of a CRC DMA calculation.
+ * @param  [in] pstcCrcDma              Pointer to a @ref stc_crc_dma_t structure.
+ * @retval None
+ */
+static void CRC_DMA_StartChunk(stc_crc_dma_t *pstcCrcDma)
+{
+    uint32_t u32Chunk = LL_MIN(pstcCrcDma->u32RemainLen, CRC_DMA_CHUNK_SIZE_MAX);
+
+    (void)DMA_SetSrcAddr(pstcCrcDma->DMAx, pstcCrcDma->u8Ch, pstcCrcDma->u32SrcAddr);
+    (void)DMA_SetBlockSize(pstcCrcDma->DMAx, pstcCrcDma->u8Ch, (uint16_t)u32Chunk);
+    (void)DMA_SetTransCount(pstcCrcDma->DMAx, pstcCrcDma->u8Ch, 1U);
+    pstcCrcDma->u32SrcAddr += (u32Chunk << 2U);
+    pstcCrcDma->u32RemainLen -= u32Chunk;
+
+    (void)DMA_ChCmd(pstcCrcDma->DMAx, pstcCrcDma->u8Ch, ENABLE);
+    DMA_MxChSWTrigger(pstcCrcDma->DMAx, (uint8_t)(1U << pstcCrcDma->u8Ch));
+}
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @}
  */
@@ -211,6 +304,7 @@ int32_t CRC_Init(const stc_crc_init_t *pstcCrcInit)
     if (NULL != pstcCrcInit) {
         DDL_ASSERT(IS_CRC_PROTOCOL(pstcCrcInit->u32Protocol));
 
+        CRC_CTX_SAVE();
         MODIFY_REG32(CM_CRC->CR, CRC_CRC32, pstcCrcInit->u32Protocol);
         MODIFY_REG32(CM_CRC->CR, CRC_CR_SELECT, pstcCrcInit->u32Protocol);
 
@@ -243,6 +337,7 @@ int32_t CRC_DeInit(void)
 
     DDL_ASSERT((CM_PWC->FPRC & PWC_FPRC_FPRCB1) == PWC_FPRC_FPRCB1);
 
+    CRC_CTX_SAVE();
     /* Reset CRC */
     WRITE_REG32(bCM_RMU->FRST0_b.CRC, 0UL);
 
@@ -288,6 +383,7 @@ uint64_t CRC_GetResult(void)
  */
 void CRC_SetInitValue(uint64_t u64Value)
 {
+    CRC_CTX_SAVE();
     if (CRC_CRC32 == READ_REG32_BIT(CM_CRC->CR, CRC_CR_CR)) {
         if (CRC_CRC64_ISO == READ_REG32_BIT(CM_CRC->CR, CRC_CR_SELECT | CRC_CR_CR)) {
             WRITE_REG32(CM_CRC->RESLT2, u64Value >> 32U);
@@ -442,6 +538,92 @@ int32_t CRC_CRC64_AccumulateData(uint8_t u8DataWidth, const void *pvData, uint32
     return i32Ret;
 }
 
+/**
+ * @brief  Calculate the CRC16 value of a byte stream and start with the previously calculated CRC as initial value.
+ * @param  [in] pvData                  Pointer to the buffer containing the data to be calculated, no alignment required.
+ * @param  [in] u32Len                  The length(counted in byte) of the data to be calculated.
+ * @param  [out] pu16Out                Pointer to the calculated CRC value.
+ * @retval int32_t:
+ *          - LL_OK:                   Calculate successfully.
+ *          - LL_ERR_INVD_PARAM:       pvData == NULL or u32Len == 0 or pu16Out == NULL.
+ * @note   The result is the same as CRC_CRC16_AccumulateData() with CRC_DATA_WIDTH_8BIT, but the aligned
+ *         part of the buffer is written in word when the protocol allows it.
+ */
+int32_t CRC_CRC16_AccumulateStream(const void *pvData, uint32_t u32Len, uint16_t *pu16Out)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pvData != NULL) && (u32Len != 0UL)) {
+        CRC_WriteStream((const uint8_t *)pvData, u32Len);
+
+        if (pu16Out != NULL) {
+            /* Get checksum */
+            *pu16Out = (uint16_t)READ_REG32(CM_CRC->RESLT1);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Calculate the CRC32 value of a byte stream and start with the previously calculated CRC as initial value.
+ * @param  [in] pvData                  Pointer to the buffer containing the data to be calculated, no alignment required.
+ * @param  [in] u32Len                  The length(counted in byte) of the data to be calculated.
+ * @param  [out] pu32Out                Pointer to the calculated CRC value.
+ * @retval int32_t:
+ *          - LL_OK:                   Calculate successfully.
+ *          - LL_ERR_INVD_PARAM:       pvData == NULL or u32Len == 0 or pu32Out == NULL.
+ * @note   The result is the same as CRC_CRC32_AccumulateData() with CRC_DATA_WIDTH_8BIT, but the aligned
+ *         part of the buffer is written in word when the protocol allows it.
+ */
+int32_t CRC_CRC32_AccumulateStream(const void *pvData, uint32_t u32Len, uint32_t *pu32Out)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pvData != NULL) && (u32Len != 0UL)) {
+        CRC_WriteStream((const uint8_t *)pvData, u32Len);
+
+        if (pu32Out != NULL) {
+            /* Get checksum */
+            *pu32Out = READ_REG32(CM_CRC->RESLT1);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Calculate the CRC64 value of a byte stream and start with the previously calculated CRC as initial value.
+ * @param  [in] pvData                  Pointer to the buffer containing the data to be calculated, no alignment required.
+ * @param  [in] u32Len                  The length(counted in byte) of the data to be calculated.
+ * @param  [out] pu64Out                Pointer to the calculated CRC value.
+ * @retval int32_t:
+ *          - LL_OK:                   Calculate successfully.
+ *          - LL_ERR_INVD_PARAM:       pvData == NULL or u32Len == 0 or pu64Out == NULL.
+ * @note   The result is the same as CRC_CRC64_AccumulateData() with CRC_DATA_WIDTH_8BIT, but the aligned
+ *         part of the buffer is written in word when the protocol allows it.
+ */
+int32_t CRC_CRC64_AccumulateStream(const void *pvData, uint32_t u32Len, uint64_t *pu64Out)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pvData != NULL) && (u32Len != 0UL)) {
+        CRC_WriteStream((const uint8_t *)pvData, u32Len);
+
+        if (pu64Out != NULL) {
+            /* Get checksum */
+            *pu64Out = READ_REG32(CM_CRC->RESLT1);
+            *pu64Out |= ((uint64_t)READ_REG32(CM_CRC->RESLT2) << 32UL);
+
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
 /**
  * @brief  Calculate the CRC16 value and start with the specified initial value.
  * @param  [in] u16InitValue            The CRC initialization value which is the valid bits same as
@@ -465,6 +647,7 @@ int32_t CRC_CRC16_Calculate(uint16_t u16InitValue, uint8_t u8DataWidth, const vo
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if ((pvData != NULL) && (u32Len != 0UL)) {
+        CRC_CTX_SAVE();
         /* Set initial value */
         WRITE_REG32(CM_CRC->RESLT1, u16InitValue);
         i32Ret = CRC_CRC16_AccumulateData(u8DataWidth, pvData, u32Len, pu16Out);
@@ -496,6 +679,7 @@ int32_t CRC_CRC32_Calculate(uint32_t u32InitValue, uint8_t u8DataWidth, const vo
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if ((pvData != NULL) && (u32Len != 0UL)) {
+        CRC_CTX_SAVE();
         /* Set initial value */
         WRITE_REG32(CM_CRC->RESLT1, u32InitValue);
         i32Ret = CRC_CRC32_AccumulateData(u8DataWidth, pvData, u32Len, pu32Out);
@@ -527,6 +711,7 @@ int32_t CRC_CRC64_Calculate(uint64_t u64InitValue, uint8_t u8DataWidth, const vo
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if ((pvData != NULL) && (u32Len != 0UL)) {
+        CRC_CTX_SAVE();
         /* Set initial value */
         WRITE_REG32(CM_CRC->RESLT1, (uint32_t)u64InitValue);
         WRITE_REG32(CM_CRC->RESLT2, (uint32_t)(u64InitValue >> 32UL));
@@ -743,6 +928,244 @@ en_flag_status_t CRC_CRC64_GetCheckResult(uint64_t u64ExpectValue)
     return enStatus;
 }
 
+/**
+ * @brief  Initialize a CRC context.
+ * @param  [out] pstcCrcCtx             Pointer to a @ref stc_crc_ctx_t structure.
+ * @param  [in] u32Protocol             CRC protocol of the context.
+ *         This parameter can be a value of @ref CRC_Protocol_Control_Bit
+ * @param  [in] u64InitValue            The CRC initialization value which is the valid bits same as
+ *                                      the bits of CRC Protocol.
+ * @retval int32_t:
+ *          - LL_OK:                   Initialize successfully.
+ *          - LL_ERR_INVD_PARAM:       pstcCrcCtx == NULL.
+ * @note   Re-initializing the selected context discards its state in the CRC unit, the next
+ *         CRC_CtxSelect() loads the new initial value.
+ */
+int32_t CRC_CtxInit(stc_crc_ctx_t *pstcCrcCtx, uint32_t u32Protocol, uint64_t u64InitValue)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (pstcCrcCtx != NULL) {
+        DDL_ASSERT(IS_CRC_PROTOCOL(u32Protocol));
+
+        if (m_pstcCrcResidentCtx == pstcCrcCtx) {
+            m_pstcCrcResidentCtx = NULL;
+        }
+        pstcCrcCtx->u32Protocol = u32Protocol;
+        pstcCrcCtx->u64Value = u64InitValue;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  De-initialize a CRC context.
+ * @param  [in] pstcCrcCtx              Pointer to a @ref stc_crc_ctx_t structure.
+ * @retval int32_t:
+ *          - LL_OK:                   De-initialize successfully.
+ *          - LL_ERR_INVD_PARAM:       pstcCrcCtx == NULL.
+ * @note   Call it before the memory of the context is released.
+ */
+int32_t CRC_CtxDeInit(stc_crc_ctx_t *pstcCrcCtx)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (pstcCrcCtx != NULL) {
+        if (m_pstcCrcResidentCtx == pstcCrcCtx) {
+            m_pstcCrcResidentCtx = NULL;
+        }
+        pstcCrcCtx->u64Value = 0ULL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Select a CRC context for the following accumulation.
+ * @param  [in] pstcCrcCtx              Pointer to a @ref stc_crc_ctx_t structure.
+ * @retval int32_t:
+ *          - LL_OK:                   Select successfully.
+ *          - LL_ERR_INVD_PARAM:       pstcCrcCtx == NULL.
+ * @note   The state of the previous context is saved from the CRC unit and the protocol and
+ *         intermediate value of this context are restored. Nothing is done if the context is
+ *         still loaded, so calling it before every CRC_CRCxx_AccumulateData() is cheap.
+ * @note   CRC_Init(), CRC_DeInit(), CRC_SetInitValue() and CRC_CRCxx_Calculate() save the loaded
+ *         context before they reconfigure the CRC unit.
+ */
+int32_t CRC_CtxSelect(stc_crc_ctx_t *pstcCrcCtx)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_crc_init_t stcCrcInit;
+
+    if (pstcCrcCtx != NULL) {
+        i32Ret = LL_OK;
+        if (m_pstcCrcResidentCtx != pstcCrcCtx) {
+            stcCrcInit.u32Protocol = pstcCrcCtx->u32Protocol;
+            stcCrcInit.u64InitValue = pstcCrcCtx->u64Value;
+            i32Ret = CRC_Init(&stcCrcInit);
+            if (LL_OK == i32Ret) {
+                m_pstcCrcResidentCtx = pstcCrcCtx;
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Initialize a DMA channel to feed the CRC data register.
+ * @param  [out] pstcCrcDma             Pointer to a @ref stc_crc_dma_t structure.
+ * @param  [in] DMAx                    DMA unit instance.
+ * @param  [in] u8Ch                    DMA channel. This parameter can be a value of @ref DMA_Channel_selection
+ * @param  [in] pfnCallback             Completion callback, called by CRC_DMA_IrqHandler(). Can be NULL.
+ * @retval int32_t:
+ *          - LL_OK:                   Initialize successfully.
+ *          - LL_ERR_INVD_PARAM:       pstcCrcDma == NULL or DMAx == NULL.
+ * @note   The clocks of CRC and DMA must be enabled, and the interrupt INT_SRC_DMAx_TCy of the channel
+ *         must be registered by the application and call CRC_DMA_IrqHandler() in its ISR.
+ */
+int32_t CRC_DMA_Init(stc_crc_dma_t *pstcCrcDma, CM_DMA_TypeDef *DMAx, uint8_t u8Ch, func_ptr_t pfnCallback)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+    stc_dma_init_t stcDmaInit;
+
+    if ((pstcCrcDma != NULL) && (DMAx != NULL)) {
+        pstcCrcDma->DMAx = DMAx;
+        pstcCrcDma->u8Ch = u8Ch;
+        pstcCrcDma->pfnCallback = pfnCallback;
+        pstcCrcDma->u32SrcAddr = 0UL;
+        pstcCrcDma->u32RemainLen = 0UL;
+        pstcCrcDma->u32Busy = 0UL;
+
+        (void)DMA_StructInit(&stcDmaInit);
+        stcDmaInit.u32IntEn = DMA_INT_ENABLE;
+        stcDmaInit.u32DestAddr = CRC_DATA_ADDR;
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_32BIT;
+        stcDmaInit.u32BlockSize = 1UL;
+        stcDmaInit.u32TransCount = 1UL;
+        stcDmaInit.u32SrcAddrInc = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+        i32Ret = DMA_Init(DMAx, u8Ch, &stcDmaInit);
+        if (LL_OK == i32Ret) {
+            DMA_ClearTransCompleteStatus(DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << u8Ch);
+            DMA_TransCompleteIntCmd(DMAx, DMA_INT_BTC_CH0 << u8Ch, DISABLE);
+            DMA_TransCompleteIntCmd(DMAx, DMA_INT_TC_CH0 << u8Ch, ENABLE);
+            DMA_Cmd(DMAx, ENABLE);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  De-initialize the DMA channel used to feed the CRC data register.
+ * @param  [in] pstcCrcDma              Pointer to a @ref stc_crc_dma_t structure.
+ * @retval int32_t:
+ *          - LL_OK:                   De-initialize successfully.
+ *          - LL_ERR_INVD_PARAM:       pstcCrcDma == NULL.
+ * @note   A running calculation is aborted, the callback is not called.
+ */
+int32_t CRC_DMA_DeInit(stc_crc_dma_t *pstcCrcDma)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (pstcCrcDma != NULL) {
+        (void)DMA_ChCmd(pstcCrcDma->DMAx, pstcCrcDma->u8Ch, DISABLE);
+        DMA_TransCompleteIntCmd(pstcCrcDma->DMAx, DMA_INT_TC_CH0 << pstcCrcDma->u8Ch, DISABLE);
+        DMA_ClearTransCompleteStatus(pstcCrcDma->DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << pstcCrcDma->u8Ch);
+        DMA_DeInit(pstcCrcDma->DMAx, pstcCrcDma->u8Ch);
+        pstcCrcDma->u32RemainLen = 0UL;
+        pstcCrcDma->u32Busy = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start a background CRC calculation of a word buffer fed by DMA.
+ * @param  [in] pstcCrcDma              Pointer to a @ref stc_crc_dma_t structure.
+ * @param  [in] pu32Data                Pointer to the buffer containing the data to be calculated, word aligned.
+ * @param  [in] u32Len                  The length(counted in word) of the data to be calculated.
+ * @retval int32_t:
+ *          - LL_OK:                   Calculation started.
+ *          - LL_ERR_INVD_PARAM:       pstcCrcDma == NULL or pu32Data == NULL or u32Len == 0.
+ *          - LL_ERR_BUSY:             The previous calculation is still running.
+ * @note   The calculation starts with the current CRC value like CRC_CRCxx_AccumulateData() with
+ *         CRC_DATA_WIDTH_32BIT, so call CRC_Init() or CRC_SetInitValue() first for a new calculation,
+ *         or start again after completion to continue a calculation over several regions.
+ * @note   The CRC unit must not be accessed by the CPU until the calculation is completed, then the
+ *         result can be read by CRC_GetResult().
+ */
+int32_t CRC_DMA_Start(stc_crc_dma_t *pstcCrcDma, const uint32_t *pu32Data, uint32_t u32Len)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((pstcCrcDma != NULL) && (pu32Data != NULL) && (u32Len != 0UL)) {
+        if (pstcCrcDma->u32Busy != 0UL) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            pstcCrcDma->u32SrcAddr = (uint32_t)pu32Data;
+            pstcCrcDma->u32RemainLen = u32Len;
+            pstcCrcDma->u32Busy = 1UL;
+            CRC_DMA_StartChunk(pstcCrcDma);
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  CRC DMA transfer complete interrupt handler.
+ * @param  [in] pstcCrcDma              Pointer to a @ref stc_crc_dma_t structure.
+ * @retval None
+ * @note   Call it in the ISR of INT_SRC_DMAx_TCy of the DMA channel specified in CRC_DMA_Init().
+ */
+void CRC_DMA_IrqHandler(stc_crc_dma_t *pstcCrcDma)
+{
+    uint32_t u32Flag;
+
+    if (pstcCrcDma != NULL) {
+        u32Flag = DMA_FLAG_TC_CH0 << pstcCrcDma->u8Ch;
+        if (SET == DMA_GetTransCompleteStatus(pstcCrcDma->DMAx, u32Flag)) {
+            DMA_ClearTransCompleteStatus(pstcCrcDma->DMAx, u32Flag | (DMA_FLAG_BTC_CH0 << pstcCrcDma->u8Ch));
+            if (pstcCrcDma->u32RemainLen != 0UL) {
+                CRC_DMA_StartChunk(pstcCrcDma);
+            } else if (pstcCrcDma->u32Busy != 0UL) {
+                pstcCrcDma->u32Busy = 0UL;
+                if (pstcCrcDma->pfnCallback != NULL) {
+                    pstcCrcDma->pfnCallback();
+                }
+            } else {
+                /* rsvd */
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Get the busy status of the CRC DMA calculation.
+ * @param  [in] pstcCrcDma              Pointer to a @ref stc_crc_dma_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ *          - SET:                     The calculation is running.
+ *          - RESET:                   Idle.
+ */
+en_flag_status_t CRC_DMA_GetBusyStatus(const stc_crc_dma_t *pstcCrcDma)
+{
+    en_flag_status_t enStatus = RESET;
+
+    if ((pstcCrcDma != NULL) && (pstcCrcDma->u32Busy != 0UL)) {
+        enStatus = SET;
+    }
+
+    return enStatus;
+}
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @}
  */
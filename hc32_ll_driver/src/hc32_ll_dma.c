@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add DMA_SaveChConfig and DMA_RestoreChConfig functions
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -1342,6 +1343,72 @@ void DMA_AHB_HProtBufCacheCmd(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, en_functional_
     }
 }
 
+/**
+ * @brief  Save the configuration registers of a DMA channel.
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  CM_DMAx or CM_DMA
+ * @param  [in] u8Ch DMA channel. @ref DMA_Channel_selection
+ * @param  [out] pstcConfig Pointer to a @ref stc_dma_llp_descriptor_t structure, which has the
+ *                          same layout as the channel registers.
+ * @retval int32_t:
+ *           - LL_OK: Save successfully.
+ *           - LL_ERR_INVD_PARAM: pstcConfig == NULL.
+ * @note   The addresses and DTCTL are saved as the live counters of the channel, they are updated by
+ *         the transfers and a LLP load, not the values originally configured.
+ */
+int32_t DMA_SaveChConfig(const CM_DMA_TypeDef *DMAx, uint8_t u8Ch, stc_dma_llp_descriptor_t *pstcConfig)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if (NULL != pstcConfig) {
+        pstcConfig->SARx      = READ_REG32(DMA_CH_REG(DMAx->SAR0, u8Ch));
+        pstcConfig->DARx      = READ_REG32(DMA_CH_REG(DMAx->DAR0, u8Ch));
+        pstcConfig->DTCTLx    = READ_REG32(DMA_CH_REG(DMAx->DTCTL0, u8Ch));
+        pstcConfig->RPTx      = READ_REG32(DMA_CH_REG(DMAx->RPT0, u8Ch));
+        pstcConfig->SNSEQCTLx = READ_REG32(DMA_CH_REG(DMAx->SNSEQCTL0, u8Ch));
+        pstcConfig->DNSEQCTLx = READ_REG32(DMA_CH_REG(DMAx->DNSEQCTL0, u8Ch));
+        pstcConfig->LLPx      = READ_REG32(DMA_CH_REG(DMAx->LLP0, u8Ch));
+        pstcConfig->CHCTLx    = READ_REG32(DMA_CH_REG(DMAx->CHCTL0, u8Ch));
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Restore the configuration registers of a DMA channel saved by DMA_SaveChConfig().
+ * @param  [in] DMAx DMA unit instance.
+ *   @arg  CM_DMAx or CM_DMA
+ * @param  [in] u8Ch DMA channel. @ref DMA_Channel_selection
+ * @param  [in] pstcConfig Pointer to a @ref stc_dma_llp_descriptor_t structure.
+ * @retval int32_t:
+ *           - LL_OK: Restore successfully.
+ *           - LL_ERR_INVD_PARAM: pstcConfig == NULL.
+ * @note   The channel must be disabled, its enable bit is not changed.
+ */
+int32_t DMA_RestoreChConfig(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_descriptor_t *pstcConfig)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_DMA_UNIT(DMAx));
+    DDL_ASSERT(IS_DMA_CH(u8Ch));
+
+    if (NULL != pstcConfig) {
+        WRITE_REG32(DMA_CH_REG(DMAx->SAR0, u8Ch), pstcConfig->SARx);
+        WRITE_REG32(DMA_CH_REG(DMAx->DAR0, u8Ch), pstcConfig->DARx);
+        WRITE_REG32(DMA_CH_REG(DMAx->DTCTL0, u8Ch), pstcConfig->DTCTLx);
+        WRITE_REG32(DMA_CH_REG(DMAx->RPT0, u8Ch), pstcConfig->RPTx);
+        WRITE_REG32(DMA_CH_REG(DMAx->SNSEQCTL0, u8Ch), pstcConfig->SNSEQCTLx);
+        WRITE_REG32(DMA_CH_REG(DMAx->DNSEQCTL0, u8Ch), pstcConfig->DNSEQCTLx);
+        WRITE_REG32(DMA_CH_REG(DMAx->LLP0, u8Ch), pstcConfig->LLPx);
+        WRITE_REG32(DMA_CH_REG(DMAx->CHCTL0, u8Ch), pstcConfig->CHCTLx);
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
 /**
  * @brief  DMA start by software request.
  * @param  [in] DMAx DMA unit instance.
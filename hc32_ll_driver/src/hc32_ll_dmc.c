@@ -8,6 +8,8 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-10-17       CDT             Remove sample clock
+   2026-10-18       CDT             Add datasheet timing calculator and self-refresh enter/exit functions
+   2026-10-18       CDT             Add external memory bandwidth and latency benchmark
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -25,6 +27,9 @@
  ******************************************************************************/
 #include "hc32_ll_dmc.h"
 #include "hc32_ll_utility.h"
+#if (LL_DMA_ENABLE == DDL_ON)
+#include "hc32_ll_dma.h"
+#endif
 
 /**
  * @addtogroup LL_Driver
@@ -211,6 +216,14 @@
 
 #define EXMC_DMC_RMU_TIMEOUT                (100U)
 
+/* The minimum CAS latency EXMC_DMC_CalcTiming() selects */
+#define EXMC_DMC_CAS_LATENCY_MIN            (2UL)
+
+/* Odd multiplier, (i * it) & (words - 1) visits every word of a power of 2 area once */
+#define EXMC_DMC_BENCH_SCATTER(i, mask)     (((i) * 0x9E3779B1UL) & (mask))
+/* Words moved by one DMA block, the DMA block size limit */
+#define EXMC_DMC_BENCH_DMA_BLOCK            (1024UL)
+
 /**
  * @}
  */
@@ -226,10 +239,194 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/* The internal RAM side of the benchmark DMA transfers, also keeps the CPU reads */
+static uint32_t m_u32BenchWord;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
+/**
+ * @defgroup EXMC_DMC_Local_Functions EXMC_DMC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Convert a time in nanoseconds to memory clock cycles, rounded up.
+ * @param  [in] u32Ns                   Time in nanoseconds.
+ * @param  [in] u32ClockKhz             Memory clock in kHz.
+ * @retval Number of cycles, at least 1.
+ */
+static uint32_t EXMC_DMC_NsToCycle(uint32_t u32Ns, uint32_t u32ClockKhz)
+{
+    return LL_MAX(((u32Ns * u32ClockKhz) + 999999UL) / 1000000UL, 1UL);
+}
+
+/**
+ * @brief  Set the state of DMC and wait for the expected status.
+ * @param  [in] u32State                The state, a value of @ref EXMC_DMC_Control_State
+ * @param  [in] u32Status               The expected status, a value of @ref EXMC_DMC_Current_Status
+ * @param  [in] u32Timeout              Maximum count of reading the status.
+ * @retval int32_t:
+ *           - LL_OK:                   DMC is in the expected status.
+ *           - LL_ERR_TIMEOUT:          Wait timeout.
+ */
+static int32_t EXMC_DMC_WaitState(uint32_t u32State, uint32_t u32Status, uint32_t u32Timeout)
+{
+    uint32_t u32Count = 0UL;
+
+    EXMC_DMC_SetState(u32State);
+    while (u32Status != EXMC_DMC_GetStatus()) {
+        if (u32Count >= u32Timeout) {
+            return LL_ERR_TIMEOUT;
+        }
+        u32Count++;
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Measure the CPU accesses to the benchmark area.
+ * @param  [in,out] pstcBench           Pointer to a @ref stc_exmc_dmc_bench_t structure.
+ * @retval None
+ */
+static void EXMC_DMC_BenchCpu(stc_exmc_dmc_bench_t *pstcBench)
+{
+    uint32_t i;
+    uint32_t u32Start;
+    uint32_t u32Sum = 0UL;
+    uint32_t u32Next;
+    const uint32_t u32Words = pstcBench->u32Size >> 2U;
+    const uint32_t u32Mask = u32Words - 1UL;
+    const uint32_t u32Bursts = u32Words / EXMC_DMC_BENCH_BURST_LEN;
+    __IO uint32_t *pu32Mem = (__IO uint32_t *)pstcBench->u32Addr;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        pu32Mem[i] = i;
+    }
+    pstcBench->u32CpuSeqWrite = DWT->CYCCNT - u32Start;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        u32Sum += pu32Mem[i];
+    }
+    pstcBench->u32CpuSeqRead = DWT->CYCCNT - u32Start;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        pu32Mem[EXMC_DMC_BENCH_SCATTER(i, u32Mask)] = i;
+    }
+    pstcBench->u32CpuRandWrite = DWT->CYCCNT - u32Start;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        u32Sum += pu32Mem[EXMC_DMC_BENCH_SCATTER(i, u32Mask)];
+    }
+    pstcBench->u32CpuRandRead = DWT->CYCCNT - u32Start;
+
+    /* Link the words in scattered order, each read needs the result of the previous one */
+    for (i = 0UL; i < u32Words; i++) {
+        pu32Mem[EXMC_DMC_BENCH_SCATTER(i, u32Mask)] = EXMC_DMC_BENCH_SCATTER(i + 1UL, u32Mask);
+    }
+    u32Next = 0UL;
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        u32Next = pu32Mem[u32Next];
+    }
+    pstcBench->u32SingleLatency = (DWT->CYCCNT - u32Start) / u32Words;
+    u32Sum += u32Next;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Bursts; i++) {
+        u32Next = EXMC_DMC_BENCH_SCATTER(i, u32Mask) & ~(EXMC_DMC_BENCH_BURST_LEN - 1UL);
+        u32Sum += pu32Mem[u32Next] + pu32Mem[u32Next + 1UL] + pu32Mem[u32Next + 2UL] + pu32Mem[u32Next + 3UL];
+    }
+    pstcBench->u32BurstLatency = (DWT->CYCCNT - u32Start) / u32Bursts;
+
+    /* Keep the reads from being optimized out */
+    m_u32BenchWord = u32Sum;
+}
+
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Measure a DMA transfer between the benchmark area and an internal RAM word.
+ * @param  [in] DMAx                    DMA unit instance.
+ * @param  [in] u8Ch                    DMA channel.
+ * @param  [in] u32Addr                 Start address of the area.
+ * @param  [in] u32Words                Number of words, a multiple of EXMC_DMC_BENCH_DMA_BLOCK or less.
+ * @param  [in] u32Write                0 to read the area, others to write it.
+ * @param  [out] pu32Cycles             The CPU cycles of the transfer.
+ * @retval int32_t:
+ *           - LL_OK:                   The transfer is completed.
+ *           - LL_ERR_TIMEOUT:          A block is not completed in time.
+ *           - LL_ERR:                  DMA is not initialized.
+ * @note   The channel configuration is overwritten, the caller saves and restores it.
+ */
+static int32_t EXMC_DMC_BenchDma(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint32_t u32Addr, uint32_t u32Words,
+                                 uint32_t u32Write, uint32_t *pu32Cycles)
+{
+    uint32_t u32Start;
+    uint32_t u32Block;
+    uint32_t u32Count;
+    int32_t i32Ret;
+    stc_dma_init_t stcDmaInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn = DMA_INT_DISABLE;
+    stcDmaInit.u32DataWidth = DMA_DATAWIDTH_32BIT;
+    stcDmaInit.u32TransCount = 1UL;
+    if (0UL == u32Write) {
+        stcDmaInit.u32DestAddr = (uint32_t)&m_u32BenchWord;
+        stcDmaInit.u32SrcAddrInc = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+    } else {
+        stcDmaInit.u32SrcAddr = (uint32_t)&m_u32BenchWord;
+        stcDmaInit.u32SrcAddrInc = DMA_SRC_ADDR_FIX;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_INC;
+    }
+    i32Ret = DMA_Init(DMAx, u8Ch, &stcDmaInit);
+    if (LL_OK != i32Ret) {
+        return LL_ERR;
+    }
+
+    u32Start = DWT->CYCCNT;
+    while ((u32Words > 0UL) && (LL_OK == i32Ret)) {
+        u32Block = LL_MIN(u32Words, EXMC_DMC_BENCH_DMA_BLOCK);
+        if (0UL == u32Write) {
+            (void)DMA_SetSrcAddr(DMAx, u8Ch, u32Addr);
+        } else {
+            (void)DMA_SetDestAddr(DMAx, u8Ch, u32Addr);
+        }
+        (void)DMA_SetBlockSize(DMAx, u8Ch, (uint16_t)u32Block);
+        (void)DMA_SetTransCount(DMAx, u8Ch, 1U);
+        DMA_ClearTransCompleteStatus(DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << u8Ch);
+        (void)DMA_ChCmd(DMAx, u8Ch, ENABLE);
+        DMA_MxChSWTrigger(DMAx, (uint8_t)(1U << u8Ch));
+        u32Count = 0UL;
+        while (SET != DMA_GetTransCompleteStatus(DMAx, DMA_FLAG_TC_CH0 << u8Ch)) {
+            if (u32Count >= EXMC_DMC_BENCH_DMA_TIMEOUT) {
+                i32Ret = LL_ERR_TIMEOUT;
+                break;
+            }
+            u32Count++;
+        }
+        u32Addr += (u32Block << 2U);
+        u32Words -= u32Block;
+    }
+    *pu32Cycles = DWT->CYCCNT - u32Start;
+
+    (void)DMA_ChCmd(DMAx, u8Ch, DISABLE);
+    DMA_ClearTransCompleteStatus(DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << u8Ch);
+
+    return i32Ret;
+}
+#endif /* LL_DMA_ENABLE */
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup EXMC_DMC_Global_Functions EXMC_DMC Global Functions
  * @{
@@ -541,6 +738,209 @@ void EXMC_DMC_SetCommand(uint32_t u32Chip, uint32_t u32Bank, uint32_t u32Cmd, ui
     WRITE_REG32(CM_DMC->CMDR, u32RegVal);
 }
 
+/**
+ * @brief  Calculate the DMC timings and refresh period from the SDRAM datasheet timings.
+ * @param  [in] pstcTimingNs            Pointer to a @ref stc_exmc_dmc_timing_ns_t structure.
+ * @param  [in] u32ExclkFreq            EXMC clock frequency in Hz, e.g. CLK_GetBusClockFreq(CLK_BUS_EXCLK).
+ * @param  [in,out] pstcDmcInit         Pointer to a @ref stc_exmc_dmc_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   The timings are calculated.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL, u32ExclkFreq is less than 1kHz or
+ *                                      u32RefreshRows is 0.
+ *           - LL_ERR:                  The clock is above the CAS latency 3 limit or a timing
+ *                                      does not fit its field.
+ * @note   1) Each timing is rounded up to whole cycles and the refresh period is rounded down,
+ *            so the result is the tightest legal setting for the clock.
+ *         2) The smallest CAS latency the clock allows is selected. tRC is kept no less than
+ *            tRAS + tRP.
+ *         3) u8DQSS, u8MRD, u8WTR and the append values are not changed, call
+ *            EXMC_DMC_StructInit() first for their defaults.
+ *         4) pstcDmcInit is not changed if the function fails.
+ */
+int32_t EXMC_DMC_CalcTiming(const stc_exmc_dmc_timing_ns_t *pstcTimingNs, uint32_t u32ExclkFreq,
+                            stc_exmc_dmc_init_t *pstcDmcInit)
+{
+    uint32_t u32CASL;
+    uint32_t u32RAS;
+    uint32_t u32RC;
+    uint32_t u32RCD;
+    uint32_t u32RFC;
+    uint32_t u32RP;
+    uint32_t u32RRD;
+    uint32_t u32WR;
+    uint32_t u32XP;
+    uint32_t u32XSR;
+    uint32_t u32RefreshPeriod;
+    const uint32_t u32ClockKhz = u32ExclkFreq / 1000UL;
+
+    if ((NULL == pstcTimingNs) || (NULL == pstcDmcInit) || (0UL == u32ClockKhz) || \
+        (0UL == pstcTimingNs->u32RefreshRows)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (u32ExclkFreq <= pstcTimingNs->u32Cl2MaxFreq) {
+        u32CASL = EXMC_DMC_CAS_LATENCY_MIN;
+    } else if (u32ExclkFreq <= pstcTimingNs->u32Cl3MaxFreq) {
+        u32CASL = EXMC_DMC_CAS_LATENCY_MIN + 1UL;
+    } else {
+        return LL_ERR;
+    }
+
+    u32RAS = EXMC_DMC_NsToCycle(pstcTimingNs->u32RAS, u32ClockKhz);
+    u32RP  = EXMC_DMC_NsToCycle(pstcTimingNs->u32RP, u32ClockKhz);
+    u32RC  = LL_MAX(EXMC_DMC_NsToCycle(pstcTimingNs->u32RC, u32ClockKhz), u32RAS + u32RP);
+    u32RCD = EXMC_DMC_NsToCycle(pstcTimingNs->u32RCD, u32ClockKhz);
+    u32RFC = EXMC_DMC_NsToCycle(pstcTimingNs->u32RFC, u32ClockKhz);
+    u32RRD = EXMC_DMC_NsToCycle(pstcTimingNs->u32RRD, u32ClockKhz);
+    u32WR  = EXMC_DMC_NsToCycle(pstcTimingNs->u32WR, u32ClockKhz);
+    u32XP  = EXMC_DMC_NsToCycle(pstcTimingNs->u32XP, u32ClockKhz);
+    u32XSR = EXMC_DMC_NsToCycle(pstcTimingNs->u32XSR, u32ClockKhz);
+    /* Average refresh interval tREFI = tREF / rows, rounded down to keep every row in time */
+    u32RefreshPeriod = (((pstcTimingNs->u32RefreshTime * 1000000UL) / pstcTimingNs->u32RefreshRows) * \
+                        u32ClockKhz) / 1000000UL;
+
+    if ((!IS_EXMC_DMC_TIMING_CASL_CYCLE(u32CASL)) || (!IS_EXMC_DMC_TIMING_RAS_CYCLE(u32RAS)) || \
+        (!IS_EXMC_DMC_TIMING_RC_CYCLE(u32RC))     || (!IS_EXMC_DMC_TIMING_RCD_B_CYCLE(u32RCD)) || \
+        (!IS_EXMC_DMC_TIMING_RFC_B_CYCLE(u32RFC)) || (!IS_EXMC_DMC_TIMING_RP_B_CYCLE(u32RP)) || \
+        (!IS_EXMC_DMC_TIMING_RRD_CYCLE(u32RRD))   || (!IS_EXMC_DMC_TIMING_WR_CYCLE(u32WR)) || \
+        (u32XP > 0xFFUL) || (u32XSR > 0xFFUL) || (0UL == u32RefreshPeriod) || \
+        (!IS_EXMC_DMC_REFRESH_PERIOD(u32RefreshPeriod))) {
+        return LL_ERR;
+    }
+
+    pstcDmcInit->u32RefreshPeriod = u32RefreshPeriod;
+    pstcDmcInit->stcTimingConfig.u8CASL = (uint8_t)u32CASL;
+    pstcDmcInit->stcTimingConfig.u8RAS = (uint8_t)u32RAS;
+    pstcDmcInit->stcTimingConfig.u8RC = (uint8_t)u32RC;
+    pstcDmcInit->stcTimingConfig.u8RCD_B = (uint8_t)u32RCD;
+    pstcDmcInit->stcTimingConfig.u8RFC_B = (uint8_t)u32RFC;
+    pstcDmcInit->stcTimingConfig.u8RP_B = (uint8_t)u32RP;
+    pstcDmcInit->stcTimingConfig.u8RRD = (uint8_t)u32RRD;
+    pstcDmcInit->stcTimingConfig.u8WR = (uint8_t)u32WR;
+    pstcDmcInit->stcTimingConfig.u8XP = (uint8_t)u32XP;
+    pstcDmcInit->stcTimingConfig.u8XSR = (uint8_t)u32XSR;
+    /* The SDRAM must stay in self-refresh for at least tRAS */
+    pstcDmcInit->stcTimingConfig.u8ESR = (uint8_t)u32RAS;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Put the SDRAM into self-refresh.
+ * @param  [in] u32Timeout              Maximum count of reading the DMC status for each state change.
+ * @retval int32_t:
+ *           - LL_OK:                   The SDRAM is in self-refresh.
+ *           - LL_ERR_TIMEOUT:          DMC did not enter the low power status, it is restored to ready.
+ * @note   1) Call it before PWC_STOP_Enter() or any mode that stops the EXMC clock, the SDRAM
+ *            keeps its contents by itself and the DMC needs no clock.
+ *         2) The code calling it, the stack and the interrupt handlers must not be in SDRAM
+ *            until EXMC_DMC_ExitSelfRefresh() returns.
+ */
+int32_t EXMC_DMC_EnterSelfRefresh(uint32_t u32Timeout)
+{
+    int32_t i32Ret;
+
+    /* Pause first so that the pending accesses are finished */
+    i32Ret = EXMC_DMC_WaitState(EXMC_DMC_CTRL_STATE_PAUSE, EXMC_DMC_CURR_STATUS_PAUSED, u32Timeout);
+    if (LL_OK == i32Ret) {
+        i32Ret = EXMC_DMC_WaitState(EXMC_DMC_CTRL_STATE_SLEEP, EXMC_DMC_CURR_STATUS_LOWPOWER, u32Timeout);
+    }
+
+    if (LL_OK != i32Ret) {
+        (void)EXMC_DMC_ExitSelfRefresh(u32Timeout);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Take the SDRAM out of self-refresh and make DMC ready.
+ * @param  [in] u32Timeout              Maximum count of reading the DMC status for each state change.
+ * @retval int32_t:
+ *           - LL_OK:                   DMC is ready.
+ *           - LL_ERR_TIMEOUT:          DMC did not become ready.
+ * @note   Call it after the wakeup from PWC_STOP_Enter() when the EXMC clock is restored.
+ *         The SDRAM is accessed no sooner than tXSR after the exit.
+ */
+int32_t EXMC_DMC_ExitSelfRefresh(uint32_t u32Timeout)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (EXMC_DMC_CURR_STATUS_LOWPOWER == EXMC_DMC_GetStatus()) {
+        i32Ret = EXMC_DMC_WaitState(EXMC_DMC_CTRL_STATE_WAKEUP, EXMC_DMC_CURR_STATUS_PAUSED, u32Timeout);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EXMC_DMC_WaitState(EXMC_DMC_CTRL_STATE_GO, EXMC_DMC_CURR_STATUS_RDY, u32Timeout);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Measure the bandwidth and latency of an external memory area.
+ * @param  [in,out] pstcBench           Pointer to a @ref stc_exmc_dmc_bench_t structure, u32Addr and
+ *                                      u32Size are given and the results are filled in.
+ * @param  [in] DMAx                    DMA unit instance for the DMA results, NULL to skip them.
+ * @param  [in] u8Ch                    DMA channel. This parameter can be a value of @ref DMA_Channel_selection
+ * @retval int32_t:
+ *           - LL_OK:                   Measure successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcBench is NULL, or the address or size is invalid.
+ *           - LL_ERR_BUSY:             The DMA channel is enabled.
+ *           - LL_ERR_TIMEOUT:          A DMA transfer is not completed in time.
+ *           - LL_ERR:                  The DMA unit is not enabled, or the channel cannot be initialized.
+ * @note   1) The area can be in the DMC or SMC space, its contents are destroyed.
+ *         2) The cycles are counted by the DWT cycle counter, disable the interrupts for stable results.
+ *            The CPU results include the loop overhead, compare them with the same area size.
+ *         3) The DMA unit must be clocked and enabled by DMA_Cmd() in the application, the channel must be
+ *            disabled. The channel configuration is restored at the end, its TC and BTC flags are cleared.
+ *            The DMA results are 0 if LL_DMA_ENABLE is off.
+ *         4) Only the numbers are returned, the bandwidth in bytes per second is
+ *            u32Size * HCLK frequency / cycles, the printing is left to the application.
+ */
+int32_t EXMC_DMC_Benchmark(stc_exmc_dmc_bench_t *pstcBench, CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    int32_t i32Ret = LL_OK;
+#if (LL_DMA_ENABLE == DDL_ON)
+    stc_dma_llp_descriptor_t stcChConfig;
+#endif
+
+    if ((NULL == pstcBench) || (!IS_ADDR_ALIGN_WORD(pstcBench->u32Addr)) || \
+        (pstcBench->u32Size < EXMC_DMC_BENCH_SIZE_MIN) || \
+        (0UL != (pstcBench->u32Size & (pstcBench->u32Size - 1UL)))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    SET_REG32_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_REG32_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+    EXMC_DMC_BenchCpu(pstcBench);
+
+    pstcBench->u32DmaRead = 0UL;
+    pstcBench->u32DmaWrite = 0UL;
+#if (LL_DMA_ENABLE == DDL_ON)
+    if (NULL != DMAx) {
+        if (0UL == READ_REG32_BIT(DMAx->EN, DMA_EN_EN)) {
+            i32Ret = LL_ERR;
+        } else if (0UL != READ_REG32_BIT(DMAx->CHEN, (1UL << u8Ch))) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            (void)DMA_SaveChConfig(DMAx, u8Ch, &stcChConfig);
+            i32Ret = EXMC_DMC_BenchDma(DMAx, u8Ch, pstcBench->u32Addr, pstcBench->u32Size >> 2U, 0UL,
+                                       &pstcBench->u32DmaRead);
+            if (LL_OK == i32Ret) {
+                i32Ret = EXMC_DMC_BenchDma(DMAx, u8Ch, pstcBench->u32Addr, pstcBench->u32Size >> 2U, 1UL,
+                                           &pstcBench->u32DmaWrite);
+            }
+            (void)DMA_RestoreChConfig(DMAx, u8Ch, &stcChConfig);
+        }
+    }
+#else
+    (void)DMAx;
+    (void)u8Ch;
+#endif
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
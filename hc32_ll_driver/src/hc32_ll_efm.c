@@ -10,6 +10,11 @@
    2024-10-17       CDT             Add const before buffer pointer to cater top-level calls
                                     Bug Fixed # judge the EFM_FLAG_OPTEND whether set o not before clear EFM_FLAG_OPTEND
    2024-11-08       CDT             Remap the sector number parameter of EFM_SingleSectorOperateCmd based on SWAP and OTP status
+   2026-10-18       CDT             Add asynchronous erase/program job queue driven by EFM interrupt
+   2026-10-18       CDT             Add log-structured key-value store on EFM sectors
+   2026-10-18       CDT             Add A/B firmware update with HASH verification and swap rollback
+   2026-10-18       CDT             Add HCLK change helpers for wait cycles and fetch benchmark
+   2026-10-18       CDT             Add ECC error telemetry and background flash scrubber
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -27,6 +32,12 @@
  ******************************************************************************/
 #include "hc32_ll_efm.h"
 #include "hc32_ll_utility.h"
+#if (LL_CRC_ENABLE == DDL_ON)
+#include "hc32_ll_crc.h"
+#endif
+#if (LL_HASH_ENABLE == DDL_ON)
+#include "hc32_ll_hash.h"
+#endif
 
 /**
  * @addtogroup LL_Driver
@@ -57,6 +68,32 @@ typedef struct {
     en_flag_status_t enOtp;
 } stc_program_param_t;
 
+/* Key-value store sector header, first program unit of each used sector */
+typedef struct {
+    uint32_t u32Magic;
+    uint32_t u32Seq;
+    uint32_t u32SeqInv;
+    uint32_t u32Rsvd;
+} stc_kv_sector_hdr_t;
+
+/* Key-value store record entry, the entries grow down from the sector end and the data grows up */
+typedef struct {
+    uint32_t u32Key;
+    uint16_t u16Len;
+    uint16_t u16Flag;
+    uint32_t u32Crc;                        /* CRC32 of u32Key, u16Len, u16Flag and the data */
+    uint16_t u16Offset;                     /* Data offset in the sector */
+    uint16_t u16Rsvd;
+} stc_kv_entry_t;
+
+/* A/B firmware update image trailer, at the start of the last sector of a bank */
+typedef struct {
+    uint32_t u32Magic;
+    uint32_t u32ImageSize;
+    uint32_t au32Rsvd[2];
+    uint8_t au8Digest[32U];                 /* SHA256 of the image */
+} stc_fw_trailer_t;
+
 /**
  * @}
  */
@@ -98,6 +135,53 @@ typedef struct {
     ((Addr) <= EFM_SWAP_FLASH1_END_ADDR)))) ? EFM_FLAG1_POS : EFM_FLAG0_POS)
 
 #define EFM_FLASH1_START_SECTOR_NUM     (128U)
+
+/* Program/erase error flags of a flash chip, shifted by the flag offset of the chip */
+#define EFM_FLAG_PE_ERR                 (EFM_FLAG_PEPRTERR | EFM_FLAG_PGSZERR | EFM_FLAG_PGMISMTCH | EFM_FLAG_OTPWERR)
+#define EFM_ASYNC_INT                   (EFM_INT_OPTEND | EFM_INT_PEERR)
+
+/**
+ * @defgroup EFM_KV_Local_Definition EFM Key-value Store Local Definition
+ * @{
+ */
+#define EFM_KV_MAGIC                    (0x4B565331UL)
+#define EFM_KV_HDR_SIZE                 (EFM_PGM_UNIT_BYTES)
+#define EFM_KV_ENTRY_SIZE               (EFM_PGM_UNIT_BYTES)
+#define EFM_KV_CRC_SIZE                 (8UL)       /* u32Key, u16Len and u16Flag */
+#define EFM_KV_FLAG_VALID               (0x5A5AU)
+#define EFM_KV_FLAG_DELETED             (0x0000U)
+#define EFM_KV_INDEX_EMPTY              (0UL)       /* An entry is never at the start of a sector */
+#define EFM_KV_SECTOR_NUM_MIN           (3UL)
+/* Free sectors needed to open a new sector, one is kept for the garbage collection */
+#define EFM_KV_FREE_MIN_APPEND          (2UL)
+#define EFM_KV_FREE_MIN_GC              (1UL)
+
+#define EFM_KV_DATA_SIZE(len)                                                   \
+(   (((uint32_t)(len)) + EFM_PGM_UNIT_BYTES - 1UL) & ~(EFM_PGM_UNIT_BYTES - 1UL))
+#define EFM_KV_SECTOR_START(kv, idx)    ((kv)->u32StartAddr + ((idx) * EFM_SECTOR_SIZE))
+#define EFM_KV_FIRST_ENTRY(kv, idx)     (EFM_KV_SECTOR_START(kv, idx) + EFM_SECTOR_SIZE - EFM_KV_ENTRY_SIZE)
+#define EFM_KV_ENTRY_SECTOR(entry)      ((entry) & ~(EFM_SECTOR_SIZE - 1UL))
+#define EFM_KV_ENTRY_DATA(entry)                                                \
+(   EFM_KV_ENTRY_SECTOR(entry) + ((const stc_kv_entry_t *)(entry))->u16Offset)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EFM_FW_Local_Definition EFM A/B Firmware Update Local Definition
+ * @{
+ */
+#define EFM_FW_MAGIC                    (0x46574142UL)
+#define EFM_FW_ACTIVE_BANK              (EFM_START_ADDR)
+#define EFM_FW_INACTIVE_BANK            (EFM_FLASH_1_START_ADDR)
+#define EFM_FW_BANK_SECTOR_NUM          (uint16_t)(EFM_FW_BANK_SIZE / EFM_SECTOR_SIZE)
+#define EFM_FW_TRAILER_ADDR(bank)       ((bank) + EFM_FW_BANK_SIZE - EFM_SECTOR_SIZE)
+/* State marks after the trailer, one program unit each */
+#define EFM_FW_CONFIRM_OFFSET           (48UL)
+#define EFM_FW_ATTEMPT_OFFSET           (EFM_FW_CONFIRM_OFFSET + EFM_PGM_UNIT_BYTES)
+/**
+ * @}
+ */
 #define FNWPRT_REG                      (CM_EFM->F0NWPRT0)
 
 #define REG_LEN                         (32U)
@@ -311,6 +395,32 @@ __EFM_FUNC static en_flag_status_t GetSwapStatus(void);
 __EFM_FUNC static en_flag_status_t GetOTPStatus(void);
 
 static void ECC_ClearSoftwareErrorRecord(void);
+static uint32_t ECC_RecordToAddr(const stc_efm_ecc_err_record_t *pstcRecord);
+static void ECC_ScrubCollect(stc_efm_ecc_scrub_t *pstcScrub, uint32_t u32Sector);
+static int32_t ECC_ScrubRewrite(stc_efm_ecc_scrub_t *pstcScrub);
+
+static void Async_StartJob(stc_efm_job_t *pstcJob);
+static void Async_WriteUnit(stc_efm_job_t *pstcJob);
+static void Async_FinishJob(int32_t i32Result);
+
+#if (LL_CRC_ENABLE == DDL_ON)
+static uint32_t KV_CalcCrc(const stc_kv_entry_t *pstcEntry, const void *pvData);
+static en_flag_status_t KV_IsBlank(uint32_t u32Addr, uint32_t u32Len);
+static en_flag_status_t KV_IsRecord(uint32_t u32Entry);
+static uint32_t KV_IndexFind(const stc_efm_kv_t *pstcKv, uint32_t u32Key);
+static void KV_IndexRemove(stc_efm_kv_t *pstcKv, uint32_t u32Slot);
+static int32_t KV_OpenSector(stc_efm_kv_t *pstcKv, uint32_t u32Sector);
+static int32_t KV_Append(stc_efm_kv_t *pstcKv, const stc_kv_entry_t *pstcEntry, const void *pvData,
+                         uint32_t u32FreeMin, uint32_t *pu32Entry);
+static int32_t KV_GcRecord(stc_efm_kv_t *pstcKv);
+static int32_t KV_GcSector(stc_efm_kv_t *pstcKv);
+static int32_t KV_Write(stc_efm_kv_t *pstcKv, const stc_kv_entry_t *pstcEntry, const void *pvData);
+#endif /* LL_CRC_ENABLE */
+
+#if (LL_HASH_ENABLE == DDL_ON)
+static int32_t FW_Program(stc_efm_fw_update_t *pstcUpdate, uint32_t u32Addr, const uint8_t *pu8Data, uint32_t u32Len);
+static int32_t FW_ProgramMark(uint32_t u32Addr);
+#endif /* LL_HASH_ENABLE */
 /**
  * @}
  */
@@ -323,6 +433,19 @@ static void ECC_ClearSoftwareErrorRecord(void);
  */
 static stc_efm_ecc_err_record_t m_astcEccErrRecord[4UL] = {0x00000000UL};
 
+/* Asynchronous job queue, the head is the running job */
+static stc_efm_job_t *m_pstcEfmJobHead = NULL;
+static stc_efm_job_t *m_pstcEfmJobTail = NULL;
+static uint8_t m_u8EfmJobFlagOffset = EFM_FLAG0_POS;
+
+/* Prefetch setting kept across a HCLK change */
+static uint32_t m_u32EfmClockChangePrefetch = 0UL;
+
+#if (LL_CRC_ENABLE == DDL_ON)
+/* Own CRC context, so the record check does not disturb other users of the CRC unit */
+static stc_crc_ctx_t m_stcKvCrcCtx;
+#endif
+
 /**
  * @}
  */
@@ -470,6 +593,126 @@ void EFM_ReadAcceleratorCmd(uint32_t u32CmdType, en_functional_state_t enNewStat
     }
 }
 
+/**
+ * @brief  Get the minimum read wait cycles for a HCLK frequency.
+ * @param  [in] u32HclkFreq             HCLK frequency in Hz.
+ * @retval A value of @ref EFM_Wait_Cycle
+ */
+uint32_t EFM_GetMinWaitCycle(uint32_t u32HclkFreq)
+{
+    uint32_t u32Cycle = 0UL;
+
+    if (u32HclkFreq > 0UL) {
+        u32Cycle = LL_MIN((u32HclkFreq - 1UL) / EFM_WAIT_CYCLE_FREQ_STEP, 15UL);
+    }
+
+    return (u32Cycle << EFM_FRMC_FLWT_POS);
+}
+
+/**
+ * @brief  Prepare the flash read for a HCLK change.
+ * @param  [in] u32NewHclkFreq          The highest HCLK frequency in Hz during the change.
+ * @retval int32_t:
+ *         - LL_OK:                     Prepare successfully.
+ *         - LL_ERR_TIMEOUT:            EFM is not ready.
+ * @note   1)Call EFM_REG_Unlock() unlock EFM register first.
+ *         2)Call it before CLK_SetSysClockSrc()/CLK_SetClockDiv(), and EFM_ClockChangeEnd() after them.
+ *           The prefetch is stopped and the wait cycles are raised here if the new clock needs more.
+ */
+int32_t EFM_ClockChangeStart(uint32_t u32NewHclkFreq)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32WaitCycle = EFM_GetMinWaitCycle(u32NewHclkFreq);
+
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+
+    m_u32EfmClockChangePrefetch = READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_PREFETE);
+    CLR_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_PREFETE);
+    /* More wait cycles are safe for both clocks */
+    if (u32WaitCycle > READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT)) {
+        i32Ret = EFM_SetWaitCycle(u32WaitCycle);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Complete the flash read setting after a HCLK change.
+ * @param  [in] u32NewHclkFreq          The new HCLK frequency in Hz.
+ * @retval int32_t:
+ *         - LL_OK:                     Complete successfully.
+ *         - LL_ERR_TIMEOUT:            EFM is not ready.
+ * @note   The wait cycles are set to the minimum for the new clock, then the cache RAM is reset and
+ *         the prefetch stopped by EFM_ClockChangeStart() is restored.
+ */
+int32_t EFM_ClockChangeEnd(uint32_t u32NewHclkFreq)
+{
+    int32_t i32Ret;
+
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+
+    i32Ret = EFM_SetWaitCycle(EFM_GetMinWaitCycle(u32NewHclkFreq));
+    SET_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_CRST);
+    CLR_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_CRST);
+    SET_REG32_BIT(CM_EFM->FRMC, m_u32EfmClockChangePrefetch);
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Measure the instruction fetch cost of a code block under several flash read settings.
+ * @param  [in] pfnCode                 The code to be measured, located in the flash.
+ * @param  [in] u32Loop                 Number of calls of pfnCode for each setting.
+ * @param  [in,out] pstcBench           Pointer to an array of @ref stc_efm_fetch_bench_t, the cycles are filled in.
+ * @param  [in] u32Num                  Number of settings.
+ * @retval int32_t:
+ *         - LL_OK:                     Measure successfully.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter, or a wait cycle setting is too small for the HCLK.
+ *         - LL_ERR_TIMEOUT:            EFM is not ready.
+ * @note   1)Call EFM_REG_Unlock() unlock EFM register first.
+ *         2)The cycles are counted by the DWT cycle counter, disable the interrupts for stable results.
+ *           Each setting starts with a reset cache RAM. The read setting is restored at the end.
+ */
+int32_t EFM_FetchBenchmark(func_ptr_t pfnCode, uint32_t u32Loop, stc_efm_fetch_bench_t *pstcBench, uint32_t u32Num)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32MinWaitCycle = EFM_GetMinWaitCycle(HCLK_VALUE);
+    uint32_t u32Frmc = READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT | EFM_CACHE_ALL);
+    uint32_t u32Start;
+    uint32_t i;
+    uint32_t j;
+
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+
+    if ((NULL == pfnCode) || (NULL == pstcBench) || (0UL == u32Loop)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    for (i = 0UL; i < u32Num; i++) {
+        if ((pstcBench[i].u32WaitCycle < u32MinWaitCycle) || (!IS_EFM_WAIT_CYCLE(pstcBench[i].u32WaitCycle)) ||
+            (0UL != (pstcBench[i].u32ReadAccl & ~(EFM_RD_ACCL_CMD_ALL & ~EFM_RD_ACCL_CMD_ACTIVATION)))) {
+            return LL_ERR_INVD_PARAM;
+        }
+    }
+
+    SET_REG32_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_REG32_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+    for (i = 0UL; (i < u32Num) && (LL_OK == i32Ret); i++) {
+        i32Ret = EFM_SetWaitCycle(pstcBench[i].u32WaitCycle);
+        MODIFY_REG32(CM_EFM->FRMC, EFM_CACHE_ALL, pstcBench[i].u32ReadAccl | EFM_FRMC_CRST);
+        CLR_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_CRST);
+        u32Start = DWT->CYCCNT;
+        for (j = 0UL; j < u32Loop; j++) {
+            pfnCode();
+        }
+        pstcBench[i].u32Cycles = DWT->CYCCNT - u32Start;
+    }
+    (void)EFM_SetWaitCycle(u32Frmc & EFM_FRMC_FLWT);
+    MODIFY_REG32(CM_EFM->FRMC, EFM_CACHE_ALL, u32Frmc | EFM_FRMC_CRST);
+    MODIFY_REG32(CM_EFM->FRMC, EFM_FRMC_CRST, u32Frmc);
+
+    return i32Ret;
+}
+
 /**
  * @brief  Enable or disable the Read of low-voltage mode.
  * @param  [in] enNewState                An @ref en_functional_state_t enumeration value.
@@ -1238,190 +1481,1299 @@ __NOINLINE __EFM_FUNC int32_t EFM_ChipErase(uint32_t u32Chip)
 }
 
 /**
- * @brief  FWMC register write enable or disable.
- * @param  [in] enNewState                An @ref en_functional_state_t enumeration value.
+ * @brief  Write the next program unit of an asynchronous job.
+ * @param  [in] pstcJob                 Pointer to the running job.
  * @retval None
  */
-void EFM_FWMC_Cmd(en_functional_state_t enNewState)
+static void Async_WriteUnit(stc_efm_job_t *pstcJob)
 {
-    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+    uint32_t au32Unit[EFM_PGM_UNIT_WORDS];
+    uint32_t u32Len = LL_MIN(pstcJob->u32ByteLen - pstcJob->u32Offset, EFM_PGM_UNIT_BYTES);
+    __IO uint32_t *pu32Dest = (__IO uint32_t *)(pstcJob->u32Addr + pstcJob->u32Offset);
 
-    if (ENABLE == enNewState) {
-        WRITE_REG32(CM_EFM->KEY1, 0x01234567UL);
-        WRITE_REG32(CM_EFM->KEY1, 0xFEDCBA98UL);
-    } else {
-        SET_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_KEY1LOCK);
-    }
+    /* The source may be unaligned and the last unit short, always go through the unit buffer */
+    Program_PadLastUnit((uint8_t *)au32Unit, (uint8_t *)(uint32_t)&pstcJob->pu8Data[pstcJob->u32Offset], u32Len);
+    pstcJob->u32Offset += u32Len;
+
+    pu32Dest[0U] = au32Unit[0U];
+    pu32Dest[1U] = au32Unit[1U];
+    pu32Dest[2U] = au32Unit[2U];
+    pu32Dest[3U] = au32Unit[3U];
 }
 
 /**
- * @brief  Get chip ID.
- * @param  None
- * @retval Returns the value of the Chip ID
+ * @brief  Start an asynchronous job.
+ * @param  [in] pstcJob                 Pointer to the job at the head of the queue.
+ * @retval None
  */
-uint32_t EFM_GetCID(void)
+static void Async_StartJob(stc_efm_job_t *pstcJob)
 {
-    return READ_REG32(CM_EFM->CHIPID);
+    m_u8EfmJobFlagOffset = GetFlagOffset(GetSwapStatus(), GetOTPStatus(), pstcJob->u32Addr);
+    WRITE_REG32(CM_EFM->FSCLR, EFM_FLAG_WRITE);
+
+    if (EFM_JOB_ERASE_SECTOR == pstcJob->u32Type) {
+        MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_ERASE_SECTOR);
+        RW_MEM32(pstcJob->u32Addr) = 0UL;
+    } else {
+        MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_SINGLE);
+        Async_WriteUnit(pstcJob);
+    }
 }
+
 /**
- * @brief  EFM OTP operate unlock.
- * @param  None
+ * @brief  Finish the running asynchronous job and start the next one.
+ * @param  [in] i32Result               Result of the running job.
  * @retval None
- * @note   Call EFM_REG_Unlock() unlock EFM register first.
  */
-void EFM_OTP_WP_Unlock(void)
+static void Async_FinishJob(int32_t i32Result)
 {
-    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+    stc_efm_job_t *pstcJob = m_pstcEfmJobHead;
 
-    WRITE_REG32(CM_EFM->KEY2, EFM_OTP_UNLOCK_KEY1);
-    WRITE_REG32(CM_EFM->KEY2, EFM_OTP_UNLOCK_KEY2);
+    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
+    /* Drop cache lines that may hold the old content of the modified area */
+    WRITE_REG32(bCM_EFM->FRMC_b.CRST, 1UL);
+    WRITE_REG32(bCM_EFM->FRMC_b.CRST, 0UL);
+
+    m_pstcEfmJobHead = pstcJob->pstcNext;
+    if (NULL == m_pstcEfmJobHead) {
+        m_pstcEfmJobTail = NULL;
+    }
+    pstcJob->pstcNext = NULL;
+    pstcJob->i32Result = i32Result;
+    if (pstcJob->pfnCallback != NULL) {
+        pstcJob->pfnCallback();
+    }
+
+    if (NULL != m_pstcEfmJobHead) {
+        Async_StartJob(m_pstcEfmJobHead);
+    }
 }
 
 /**
- * @brief  EFM OTP write protect lock.
+ * @brief  Initialize the asynchronous erase/program engine.
  * @param  None
- * @retval None
- */
-void EFM_OTP_WP_Lock(void)
-{
-    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+ * @retval int32_t:
+ *         - LL_OK:                     Initialize successfully.
+ *         - LL_ERR_NOT_RDY:            EFM or FWMC register is locked.
+ *         - LL_ERR_BUSY:               Jobs are still queued.
+ * @note   1)Call EFM_REG_Unlock() and EFM_FWMC_Cmd(ENABLE) first, keep them unlocked while jobs are queued.
+ *         2)Register INT_SRC_EFM_OPTEND and INT_SRC_EFM_PEERR, and call EFM_AsyncIrqHandler() in
+ *         EFM_OpEnd_IrqHandler() and EFM_ProgramEraseError_IrqHandler().
+ *         3)The bus is released during program and erase, so the code and data of the other flash chip,
+ *         including the ISR, can be accessed while a job is running.
+ */
+int32_t EFM_AsyncInit(void)
+{
+    if ((!IS_EFM_REG_UNLOCK()) || (!IS_EFM_FWMC_UNLOCK())) {
+        return LL_ERR_NOT_RDY;
+    }
+    if (NULL != m_pstcEfmJobHead) {
+        return LL_ERR_BUSY;
+    }
 
-    SET_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_KEY2LOCK);
+    WRITE_REG32(bCM_EFM->FWMC_b.BUSHLDCTL, EFM_BUS_RELEASE);
+    WRITE_REG32(CM_EFM->FSCLR, EFM_FLAG_WRITE);
+    SET_REG32_BIT(CM_EFM->FITE, EFM_ASYNC_INT);
+
+    return LL_OK;
 }
 
 /**
- * @brief  Enable OTP Function
+ * @brief  De-initialize the asynchronous erase/program engine.
  * @param  None
- * @retval Function execution status @ref Generic_Error_Codes
- *         - LL_OK:                     Success
- *         - LL_ERR:                    Fail
+ * @retval int32_t:
+ *         - LL_OK:                     De-initialize successfully.
+ *         - LL_ERR_BUSY:               Jobs are still queued.
  */
-int32_t EFM_OTP_Enable(void)
+int32_t EFM_AsyncDeInit(void)
 {
-    int32_t i32Ret = LL_OK;
-    uint32_t u32EnableCode[4] = {0UL};
-
-    DDL_ASSERT(IS_EFM_OTP_UNLOCK());
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
 
-    if (EFM_GetOTPStatus() == SET) {
-        return i32Ret;
+    if (NULL != m_pstcEfmJobHead) {
+        return LL_ERR_BUSY;
     }
-    i32Ret = Program_Implement(EFM_OTP_ENABLE_ADDR,
-                               (uint8_t *)u32EnableCode,
-                               EFM_PGM_UNIT_BYTES,
-                               EFM_MD_PGM_SINGLE);
-    return i32Ret;
+    CLR_REG32_BIT(CM_EFM->FITE, EFM_ASYNC_INT);
+
+    return LL_OK;
 }
 
 /**
- * @brief  Set block OTP by the lock address of block
- * @param  [in]  u32Addr   The lock address of block @ref EFM_OTP_BLOCK_LOCKADDR
- * @retval Function execution status @ref Generic_Error_Codes
- *         - LL_OK:                     Success
- *         - LL_ERR:                    Fail
- */
-int32_t EFM_OTP_Lock(uint32_t u32Addr)
-{
-    int32_t i32Ret;
-    uint32_t u32LockCode[4] = {0UL};
+ * @brief  Queue an erase or program job, it starts at once if the engine is idle.
+ * @param  [in] pstcJob                 Pointer to a @ref stc_efm_job_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                     The job is queued.
+ *         - LL_ERR_INVD_PARAM:         Invalid job, the program range crosses the flash chips, or the job
+ *                                      targets the flash chip that is executing the code.
+ *         - LL_ERR_NOT_RDY:            EFM or FWMC register is locked.
+ * @note   The chip executing the code is the one holding this driver, the job must target the other one.
+ *         The check is skipped if the driver runs from the RAM. Jobs of both chips can be queued, they run
+ *         one after the other.
+ */
+int32_t EFM_AsyncSubmit(stc_efm_job_t *pstcJob)
+{
+    uint32_t u32EndAddr;
+    uint32_t u32IntEn;
+    uint32_t u32CodeAddr = (uint32_t)&EFM_AsyncSubmit;
+    en_flag_status_t enSwap;
+    en_flag_status_t enOtp;
 
-    DDL_ASSERT(IS_EFM_OTP_UNLOCK());
-    DDL_ASSERT((u32Addr >= EFM_OTP_LOCK_ADDR_START) && (u32Addr < EFM_OTP_LOCK_ADDR_END));
+    if (NULL == pstcJob) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if ((!IS_EFM_REG_UNLOCK()) || (!IS_EFM_FWMC_UNLOCK())) {
+        return LL_ERR_NOT_RDY;
+    }
+    if (EFM_JOB_ERASE_SECTOR == pstcJob->u32Type) {
+        if ((pstcJob->u32Addr > EFM_END_ADDR) || (!IS_ADDR_ALIGN_WORD(pstcJob->u32Addr))) {
+            return LL_ERR_INVD_PARAM;
+        }
+    } else if (EFM_JOB_PGM == pstcJob->u32Type) {
+        if ((NULL == pstcJob->pu8Data) || (0UL == pstcJob->u32ByteLen) || (!IS_ALIGNED_PGM_ADDR(pstcJob->u32Addr))) {
+            return LL_ERR_INVD_PARAM;
+        }
+        u32EndAddr = pstcJob->u32Addr + pstcJob->u32ByteLen - 1UL;
+        if ((u32EndAddr > EFM_END_ADDR) || (u32EndAddr < pstcJob->u32Addr) ||
+            ((pstcJob->u32Addr < EFM_FLASH_1_START_ADDR) != (u32EndAddr < EFM_FLASH_1_START_ADDR))) {
+            return LL_ERR_INVD_PARAM;
+        }
+    } else {
+        return LL_ERR_INVD_PARAM;
+    }
+    /* The chip cannot be read while it is erased or programmed */
+    if (u32CodeAddr < EFM_END_ADDR) {
+        enSwap = EFM_GetSwapStatus();
+        enOtp = EFM_GetOTPStatus();
+        if (EFM_FLAG_OFFSET(enSwap, enOtp, pstcJob->u32Addr) == EFM_FLAG_OFFSET(enSwap, enOtp, u32CodeAddr)) {
+            return LL_ERR_INVD_PARAM;
+        }
+    }
 
-    i32Ret = Program_Implement(u32Addr,
-                               (uint8_t *)u32LockCode,
-                               EFM_PGM_UNIT_BYTES,
-                               EFM_MD_PGM_SINGLE);
-    return i32Ret;
+    pstcJob->i32Result = LL_ERR_BUSY;
+    pstcJob->u32Offset = 0UL;
+    pstcJob->pstcNext = NULL;
+
+    /* Keep the ISR away from the queue while linking */
+    u32IntEn = READ_REG32_BIT(CM_EFM->FITE, EFM_ASYNC_INT);
+    CLR_REG32_BIT(CM_EFM->FITE, EFM_ASYNC_INT);
+    if (NULL == m_pstcEfmJobHead) {
+        m_pstcEfmJobHead = pstcJob;
+        m_pstcEfmJobTail = pstcJob;
+        Async_StartJob(pstcJob);
+    } else {
+        m_pstcEfmJobTail->pstcNext = pstcJob;
+        m_pstcEfmJobTail = pstcJob;
+    }
+    SET_REG32_BIT(CM_EFM->FITE, u32IntEn);
+
+    return LL_OK;
 }
 
 /**
- * @brief  Set block OTP by a range of block index
- * @param  [in]  u32BlockStartIdx       Start block index,range from 0 to @ref EFM_OTP_BLOCK_IDX_MAX
- * @param  [in]  u16Count               Number of block(s) starting from u32BlockStartIdx
- * @retval Function execution status @ref Generic_Error_Codes
- *         - LL_OK:                     Success
- *         - LL_ERR:                    Fail
+ * @brief  Asynchronous erase/program engine interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call it in EFM_OpEnd_IrqHandler() and EFM_ProgramEraseError_IrqHandler().
  */
-int32_t EFM_OTP_LockBlock(uint32_t u32BlockStartIdx, uint16_t u16Count)
+void EFM_AsyncIrqHandler(void)
 {
-    int32_t i32Ret = LL_OK;
-    uint32_t i, j;
-    uint32_t u32ReadAcclCmd = READ_REG32_BIT(CM_EFM->FRMC, EFM_RD_ACCL_CMD_ALL);
-    uint32_t *pu32LockAddr;
-    uint32_t u32EndIdx = u32BlockStartIdx + u16Count - 1U;
-
-    DDL_ASSERT(IS_EFM_REG_UNLOCK());
-    DDL_ASSERT(IS_EFM_FWMC_UNLOCK());
-    DDL_ASSERT((EFM_FLAG_RDY) == READ_REG32_BIT(CM_EFM->FSR, (EFM_FLAG_RDY)));
-    DDL_ASSERT((EFM_FLAG_RDY1) == READ_REG32_BIT(CM_EFM->FSR, (EFM_FLAG_RDY1)));
-    DDL_ASSERT(IS_EFM_OTP_UNLOCK());
-    DDL_ASSERT(u32EndIdx <= EFM_OTP_BLOCK_IDX_MAX);
-    DDL_ASSERT(u32BlockStartIdx <= u32EndIdx);
+    stc_efm_job_t *pstcJob = m_pstcEfmJobHead;
+    uint32_t u32OptEnd = EFM_FLAG_OPTEND << m_u8EfmJobFlagOffset;
+    uint32_t u32Err = EFM_FLAG_PE_ERR << m_u8EfmJobFlagOffset;
+    uint32_t u32Status = READ_REG32(CM_EFM->FSR);
 
-    /*Prepare Program*/
-    CLR_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
-    SET_REG32_BIT(CM_EFM->FSCLR, EFM_FLAG_WRITE);
+    if (NULL == pstcJob) {
+        WRITE_REG32(CM_EFM->FSCLR, EFM_FLAG_OPTEND | EFM_FLAG_OPTEND1);
+        return;
+    }
 
-    /*Program lock code*/
-    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_SINGLE);
-    for (i = u32BlockStartIdx; i <= u32EndIdx; i++) {
-        pu32LockAddr = (uint32_t *)EFM_OTP_BLOCK_LOCKADDR(i);
-        for (j = 0U; j < EFM_PGM_UNIT_WORDS; j++) {
-            *pu32LockAddr++ = 0UL;
-        }
-        if (i32Ret != WaitAndClearOPTEndFlag(EFM_FLAG0_POS)) {
-            break;
+    if (0UL != (u32Status & u32Err)) {
+        WRITE_REG32(CM_EFM->FSCLR, EFM_FLAG_WRITE);
+        Async_FinishJob(LL_ERR);
+    } else if (0UL != (u32Status & u32OptEnd)) {
+        WRITE_REG32(CM_EFM->FSCLR, u32OptEnd);
+        if ((EFM_JOB_PGM == pstcJob->u32Type) && (pstcJob->u32Offset < pstcJob->u32ByteLen)) {
+            Async_WriteUnit(pstcJob);
+        } else {
+            Async_FinishJob(LL_OK);
         }
+    } else {
+        /* rsvd */
     }
-    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
-
-    /* Recover read accelerator cmd */
-    MODIFY_REG32(CM_EFM->FRMC, EFM_CACHE_ALL, u32ReadAcclCmd);
-
-    return i32Ret;
 }
 
 /**
- * @brief  Get otp enabled or disabled status
+ * @brief  Get the busy status of the asynchronous erase/program engine.
  * @param  None
- * @retval en_flag_status_t:
- *         - SET:                       OTP enabled
- *         - RESET:                     OTP disable
+ * @retval An @ref en_flag_status_t enumeration type value.
+ *         - SET:                       Jobs are queued or running.
+ *         - RESET:                     Idle.
  */
-en_flag_status_t EFM_GetOTPStatus(void)
+en_flag_status_t EFM_AsyncGetBusyStatus(void)
 {
-    return GetOTPStatus();
+    return (NULL != m_pstcEfmJobHead) ? SET : RESET;
 }
 
+#if (LL_CRC_ENABLE == DDL_ON)
 /**
- * @brief  Sector protected register lock.
- * @param  [in] u32RegLock                      Specifies sector protected register locking.
- *  @arg   EFM_WRLOCK0 ~ EFM_WRLOCK7
- * @retval None
- * @note   Call EFM_REG_Unlock() unlock EFM register first.
+ * @brief  Calculate the CRC32 of a key-value record.
+ * @param  [in] pstcEntry               Pointer to the record entry.
+ * @param  [in] pvData                  Pointer to the record data.
+ * @retval The CRC32 value.
  */
-void EFM_SectorProtectRegLock(uint32_t u32RegLock)
+static uint32_t KV_CalcCrc(const stc_kv_entry_t *pstcEntry, const void *pvData)
 {
-    DDL_ASSERT(IS_EFM_SECTOR_PROTECT_REG_LOCK(u32RegLock));
-    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+    uint32_t u32Crc = 0UL;
 
-    SET_REG32_BIT(CM_EFM->WLOCK, u32RegLock);
+    (void)CRC_CtxInit(&m_stcKvCrcCtx, CRC_CRC32, CRC_INIT_VALUE_DEFAULT);
+    (void)CRC_CtxSelect(&m_stcKvCrcCtx);
+    (void)CRC_CRC32_AccumulateStream(pstcEntry, EFM_KV_CRC_SIZE, &u32Crc);
+    if (0U != pstcEntry->u16Len) {
+        (void)CRC_CRC32_AccumulateStream(pvData, pstcEntry->u16Len, &u32Crc);
+    }
+
+    return u32Crc;
 }
 
 /**
- * @brief  Set sector lock or unlock (Single).
- * @param  [in] u8SectorNum     Specifies sector for unlock.
- *                              This parameter can be set 0~255.
- *                              see the macro definition for @ref EFM_Sector_Count
- * @param  [in] enNewState      An @ref en_functional_state_t enumeration value.
- * @retval None
- * @note   Call EFM_REG_Unlock() unlock EFM register first.
- *         If you want to unlock sequence sectors,Please call EFM_SequenceSectorOperateCmd function
+ * @brief  Check whether a flash area is blank.
+ * @param  [in] u32Addr                 Start address, word aligned.
+ * @param  [in] u32Len                  Length in bytes, multiple of 4.
+ * @retval An @ref en_flag_status_t enumeration type value.
  */
-void EFM_SingleSectorOperateCmd(uint8_t u8SectorNum, en_functional_state_t enNewState)
+static en_flag_status_t KV_IsBlank(uint32_t u32Addr, uint32_t u32Len)
 {
-    __IO uint32_t *EFM_FxNWPRTy;
+    uint32_t i;
+
+    for (i = 0UL; i < u32Len; i += 4UL) {
+        if (0xFFFFFFFFUL != RW_MEM32(u32Addr + i)) {
+            return RESET;
+        }
+    }
+
+    return SET;
+}
+
+/**
+ * @brief  Check whether a programmed entry describes a complete and intact record.
+ * @param  [in] u32Entry                Entry address.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t KV_IsRecord(uint32_t u32Entry)
+{
+    const stc_kv_entry_t *pstcEntry = (const stc_kv_entry_t *)u32Entry;
+    uint32_t u32Data;
+
+    if ((EFM_KV_KEY_INVD == pstcEntry->u32Key) ||
+        ((EFM_KV_FLAG_VALID != pstcEntry->u16Flag) && (EFM_KV_FLAG_DELETED != pstcEntry->u16Flag))) {
+        return RESET;
+    }
+    u32Data = EFM_KV_ENTRY_DATA(u32Entry);
+    if ((pstcEntry->u16Offset < EFM_KV_HDR_SIZE) || ((u32Data + EFM_KV_DATA_SIZE(pstcEntry->u16Len)) > u32Entry)) {
+        return RESET;
+    }
+
+    return (KV_CalcCrc(pstcEntry, (const void *)u32Data) == pstcEntry->u32Crc) ? SET : RESET;
+}
+
+/**
+ * @brief  Find the index slot of a key.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] u32Key                  The key.
+ * @retval The slot holding the key, or the empty slot where the key is to be inserted.
+ * @note   The index always keeps an empty slot, so the linear probing terminates.
+ */
+static uint32_t KV_IndexFind(const stc_efm_kv_t *pstcKv, uint32_t u32Key)
+{
+    uint32_t u32Mask = pstcKv->u32IndexSize - 1UL;
+    uint32_t u32Hash = u32Key * 0x9E3779B1UL;
+    uint32_t u32Slot = (u32Hash ^ (u32Hash >> 16U)) & u32Mask;
+    uint32_t u32Addr = pstcKv->pu32Index[u32Slot];
+
+    while ((EFM_KV_INDEX_EMPTY != u32Addr) && (RW_MEM32(u32Addr) != u32Key)) {
+        u32Slot = (u32Slot + 1UL) & u32Mask;
+        u32Addr = pstcKv->pu32Index[u32Slot];
+    }
+
+    return u32Slot;
+}
+
+/**
+ * @brief  Remove an index slot, the following entries are shifted back to keep the probing chains.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] u32Slot                 The slot to be removed.
+ * @retval None
+ */
+static void KV_IndexRemove(stc_efm_kv_t *pstcKv, uint32_t u32Slot)
+{
+    uint32_t u32Mask = pstcKv->u32IndexSize - 1UL;
+    uint32_t u32Next = (u32Slot + 1UL) & u32Mask;
+    uint32_t u32Addr = pstcKv->pu32Index[u32Next];
+    uint32_t u32Hash;
+    uint32_t u32Home;
+
+    while (EFM_KV_INDEX_EMPTY != u32Addr) {
+        u32Hash = RW_MEM32(u32Addr) * 0x9E3779B1UL;
+        u32Home = (u32Hash ^ (u32Hash >> 16U)) & u32Mask;
+        /* Move the entry into the hole unless its home slot lies between the hole and the entry */
+        if (((u32Next - u32Home) & u32Mask) >= ((u32Next - u32Slot) & u32Mask)) {
+            pstcKv->pu32Index[u32Slot] = u32Addr;
+            u32Slot = u32Next;
+        }
+        u32Next = (u32Next + 1UL) & u32Mask;
+        u32Addr = pstcKv->pu32Index[u32Next];
+    }
+    pstcKv->pu32Index[u32Slot] = EFM_KV_INDEX_EMPTY;
+    pstcKv->u32KeyCount--;
+}
+
+/**
+ * @brief  Open a free sector as the active sector.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] u32Sector               Sector index in the store.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t KV_OpenSector(stc_efm_kv_t *pstcKv, uint32_t u32Sector)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Addr = EFM_KV_SECTOR_START(pstcKv, u32Sector);
+    stc_kv_sector_hdr_t stcHdr;
+
+    if (RESET == KV_IsBlank(u32Addr, EFM_SECTOR_SIZE)) {
+        i32Ret = EFM_SectorErase(u32Addr);
+    }
+    if (LL_OK == i32Ret) {
+        stcHdr.u32Magic = EFM_KV_MAGIC;
+        stcHdr.u32Seq = pstcKv->u32Seq + 1UL;
+        stcHdr.u32SeqInv = ~stcHdr.u32Seq;
+        stcHdr.u32Rsvd = 0xFFFFFFFFUL;
+        i32Ret = EFM_Program(u32Addr, (const uint8_t *)&stcHdr, EFM_KV_HDR_SIZE);
+    }
+    if (LL_OK == i32Ret) {
+        pstcKv->u32Seq++;
+        pstcKv->u32ActiveSector = u32Sector;
+        pstcKv->u32UsedSectorNum++;
+        pstcKv->u32WriteAddr = u32Addr + EFM_KV_HDR_SIZE;
+        pstcKv->u32EntryAddr = EFM_KV_FIRST_ENTRY(pstcKv, u32Sector);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Append a record to the active sector, a new sector is opened when it is full.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] pstcEntry               Pointer to the record entry, the data offset is filled in here.
+ * @param  [in] pvData                  Pointer to the record data.
+ * @param  [in] u32FreeMin              Free sectors needed to open a new sector.
+ * @param  [out] pu32Entry              Address of the appended entry.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t KV_Append(stc_efm_kv_t *pstcKv, const stc_kv_entry_t *pstcEntry, const void *pvData,
+                         uint32_t u32FreeMin, uint32_t *pu32Entry)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Size = EFM_KV_DATA_SIZE(pstcEntry->u16Len);
+    stc_kv_entry_t stcEntry;
+
+    if ((pstcKv->u32WriteAddr + u32Size) > pstcKv->u32EntryAddr) {
+        if ((pstcKv->u32SectorNum - pstcKv->u32UsedSectorNum) < u32FreeMin) {
+            return LL_ERR_BUF_FULL;
+        }
+        i32Ret = KV_OpenSector(pstcKv, (pstcKv->u32ActiveSector + 1UL) % pstcKv->u32SectorNum);
+    }
+    if (LL_OK == i32Ret) {
+        stcEntry = *pstcEntry;
+        stcEntry.u16Offset = (uint16_t)(pstcKv->u32WriteAddr - EFM_KV_ENTRY_SECTOR(pstcKv->u32EntryAddr));
+        stcEntry.u16Rsvd = 0xFFFFU;
+        /* Data first, an entry cut by power loss fails the check and is skipped by its fixed size */
+        if (0U != stcEntry.u16Len) {
+            i32Ret = EFM_Program(pstcKv->u32WriteAddr, (const uint8_t *)pvData, stcEntry.u16Len);
+            pstcKv->u32WriteAddr += u32Size;
+        }
+        if (LL_OK == i32Ret) {
+            i32Ret = EFM_Program(pstcKv->u32EntryAddr, (const uint8_t *)&stcEntry, EFM_KV_ENTRY_SIZE);
+            if (LL_OK == i32Ret) {
+                *pu32Entry = pstcKv->u32EntryAddr;
+            }
+            /* A blank slot ends the entry scan, so it is reused instead of skipped */
+            if ((LL_OK == i32Ret) || (RESET == KV_IsBlank(pstcKv->u32EntryAddr, EFM_KV_ENTRY_SIZE))) {
+                pstcKv->u32EntryAddr -= EFM_KV_ENTRY_SIZE;
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Collect one record of the oldest sector, the sector is erased after its last record.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t KV_GcRecord(stc_efm_kv_t *pstcKv)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32SectorAddr = EFM_KV_SECTOR_START(pstcKv, pstcKv->u32OldestSector);
+    const stc_kv_entry_t *pstcEntry = (const stc_kv_entry_t *)pstcKv->u32GcAddr;
+    uint32_t u32Slot;
+    uint32_t u32Entry;
+
+    if ((pstcKv->u32GcAddr < (u32SectorAddr + EFM_KV_HDR_SIZE)) ||
+        (SET == KV_IsBlank(pstcKv->u32GcAddr, EFM_KV_ENTRY_SIZE))) {
+        i32Ret = EFM_SectorErase(u32SectorAddr);
+        if (LL_OK == i32Ret) {
+            pstcKv->u32OldestSector = (pstcKv->u32OldestSector + 1UL) % pstcKv->u32SectorNum;
+            pstcKv->u32UsedSectorNum--;
+            pstcKv->u32GcAddr = 0UL;
+        }
+    } else {
+        /* Only indexed entries are live, broken and outdated ones are dropped */
+        u32Slot = KV_IndexFind(pstcKv, pstcEntry->u32Key);
+        if (pstcKv->pu32Index[u32Slot] == pstcKv->u32GcAddr) {
+            if (EFM_KV_FLAG_DELETED == pstcEntry->u16Flag) {
+                /* No older version is left behind the oldest sector */
+                KV_IndexRemove(pstcKv, u32Slot);
+            } else {
+                i32Ret = KV_Append(pstcKv, pstcEntry, (const void *)EFM_KV_ENTRY_DATA(pstcKv->u32GcAddr),
+                                   EFM_KV_FREE_MIN_GC, &u32Entry);
+                if (LL_OK == i32Ret) {
+                    pstcKv->pu32Index[u32Slot] = u32Entry;
+                }
+            }
+        }
+        if (LL_OK == i32Ret) {
+            pstcKv->u32GcAddr -= EFM_KV_ENTRY_SIZE;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Collect the rest of the oldest sector.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t KV_GcSector(stc_efm_kv_t *pstcKv)
+{
+    int32_t i32Ret;
+
+    if (0UL == pstcKv->u32GcAddr) {
+        pstcKv->u32GcAddr = EFM_KV_FIRST_ENTRY(pstcKv, pstcKv->u32OldestSector);
+    }
+    do {
+        i32Ret = KV_GcRecord(pstcKv);
+    } while ((LL_OK == i32Ret) && (0UL != pstcKv->u32GcAddr));
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Write a record and point the index of its key to it, sectors are collected if the store is full.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] pstcEntry               Pointer to the record entry.
+ * @param  [in] pvData                  Pointer to the record data.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t KV_Write(stc_efm_kv_t *pstcKv, const stc_kv_entry_t *pstcEntry, const void *pvData)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Retry = pstcKv->u32SectorNum;
+    uint32_t u32Entry = 0UL;
+    uint32_t u32Slot;
+
+    /* The space left in the last opened sector belongs to the running collection */
+    if (pstcKv->u32UsedSectorNum == pstcKv->u32SectorNum) {
+        i32Ret = KV_GcSector(pstcKv);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = KV_Append(pstcKv, pstcEntry, pvData, EFM_KV_FREE_MIN_APPEND, &u32Entry);
+    }
+    while ((LL_ERR_BUF_FULL == i32Ret) && (u32Retry > 0UL) && (pstcKv->u32UsedSectorNum > 1UL)) {
+        u32Retry--;
+        i32Ret = KV_GcSector(pstcKv);
+        if (LL_OK == i32Ret) {
+            i32Ret = KV_Append(pstcKv, pstcEntry, pvData, EFM_KV_FREE_MIN_APPEND, &u32Entry);
+        }
+    }
+
+    if (LL_OK == i32Ret) {
+        /* The collection may have moved the index entries */
+        u32Slot = KV_IndexFind(pstcKv, pstcEntry->u32Key);
+        if (EFM_KV_INDEX_EMPTY == pstcKv->pu32Index[u32Slot]) {
+            pstcKv->u32KeyCount++;
+        }
+        pstcKv->pu32Index[u32Slot] = u32Entry;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Mount the key-value store, the index is rebuilt from the records in flash.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure with the first four members set.
+ * @retval int32_t:
+ *         - LL_OK:                     Mount successfully.
+ *         - LL_ERR_INVD_PARAM:         Invalid store range or index.
+ *         - LL_ERR_BUF_FULL:           The index is too small for the stored keys.
+ *         - LL_ERR:                    The sectors are inconsistent or erase/program failed, call EFM_KV_Format().
+ * @note   1)Call EFM_REG_Unlock() and EFM_FWMC_Cmd(ENABLE) first, and enable the CRC clock.
+ *         2)Sectors without a valid header are erased. A store without any valid sector is formatted.
+ *         3)Do not use the store while the asynchronous engine of EFM_AsyncSubmit() is running.
+ */
+int32_t EFM_KV_Init(stc_efm_kv_t *pstcKv)
+{
+    int32_t i32Ret = LL_OK;
+    const stc_kv_sector_hdr_t *pstcSector;
+    uint32_t u32MinSeq = 0xFFFFFFFFUL;
+    uint32_t u32Used = 0UL;
+    uint32_t u32Oldest = 0UL;
+    uint32_t u32Sector;
+    uint32_t u32Addr;
+    uint32_t u32Entry;
+    uint32_t u32DataEnd;
+    uint32_t u32Slot;
+    uint32_t i;
+
+    if ((NULL == pstcKv) || (NULL == pstcKv->pu32Index) || (pstcKv->u32IndexSize < 2UL) ||
+        (0UL != (pstcKv->u32IndexSize & (pstcKv->u32IndexSize - 1UL))) ||
+        (pstcKv->u32SectorNum < EFM_KV_SECTOR_NUM_MIN) || (!IS_ADDR_ALIGN(pstcKv->u32StartAddr, EFM_SECTOR_SIZE)) ||
+        ((pstcKv->u32StartAddr + (pstcKv->u32SectorNum * EFM_SECTOR_SIZE) - 1UL) > EFM_END_ADDR)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    for (i = 0UL; i < pstcKv->u32IndexSize; i++) {
+        pstcKv->pu32Index[i] = EFM_KV_INDEX_EMPTY;
+    }
+    pstcKv->u32KeyCount = 0UL;
+    pstcKv->u32GcAddr = 0UL;
+
+    /* Find the oldest valid sector, erase the invalid ones */
+    for (i = 0UL; (i < pstcKv->u32SectorNum) && (LL_OK == i32Ret); i++) {
+        u32Addr = EFM_KV_SECTOR_START(pstcKv, i);
+        pstcSector = (const stc_kv_sector_hdr_t *)u32Addr;
+        if ((EFM_KV_MAGIC == pstcSector->u32Magic) && (pstcSector->u32Seq == ~pstcSector->u32SeqInv)) {
+            u32Used++;
+            if (pstcSector->u32Seq < u32MinSeq) {
+                u32MinSeq = pstcSector->u32Seq;
+                u32Oldest = i;
+            }
+        } else if (RESET == KV_IsBlank(u32Addr, EFM_SECTOR_SIZE)) {
+            i32Ret = EFM_SectorErase(u32Addr);
+        } else {
+            /* rsvd */
+        }
+    }
+    if (LL_OK != i32Ret) {
+        return i32Ret;
+    }
+    if (0UL == u32Used) {
+        return EFM_KV_Format(pstcKv);
+    }
+
+    /* The used sectors follow each other in ring order, replay them from the oldest */
+    for (i = 0UL; i < u32Used; i++) {
+        u32Sector = (u32Oldest + i) % pstcKv->u32SectorNum;
+        u32Addr = EFM_KV_SECTOR_START(pstcKv, u32Sector);
+        pstcSector = (const stc_kv_sector_hdr_t *)u32Addr;
+        if ((EFM_KV_MAGIC != pstcSector->u32Magic) || (pstcSector->u32Seq != ~pstcSector->u32SeqInv) ||
+            (pstcSector->u32Seq != (u32MinSeq + i))) {
+            return LL_ERR;
+        }
+        u32DataEnd = u32Addr + EFM_KV_HDR_SIZE;
+        u32Entry = EFM_KV_FIRST_ENTRY(pstcKv, u32Sector);
+        while ((u32Entry >= (u32Addr + EFM_KV_HDR_SIZE)) && (RESET == KV_IsBlank(u32Entry, EFM_KV_ENTRY_SIZE))) {
+            if (SET == KV_IsRecord(u32Entry)) {
+                u32Slot = KV_IndexFind(pstcKv, RW_MEM32(u32Entry));
+                if (EFM_KV_INDEX_EMPTY == pstcKv->pu32Index[u32Slot]) {
+                    if ((pstcKv->u32KeyCount + 1UL) >= pstcKv->u32IndexSize) {
+                        return LL_ERR_BUF_FULL;
+                    }
+                    pstcKv->u32KeyCount++;
+                }
+                pstcKv->pu32Index[u32Slot] = u32Entry;
+                u32DataEnd = LL_MAX(u32DataEnd, EFM_KV_ENTRY_DATA(u32Entry) +
+                                    EFM_KV_DATA_SIZE(((const stc_kv_entry_t *)u32Entry)->u16Len));
+            }
+            u32Entry -= EFM_KV_ENTRY_SIZE;
+        }
+        /* Skip the data of records cut by power loss */
+        for (u32Addr = u32DataEnd; u32Addr < u32Entry; u32Addr += EFM_PGM_UNIT_BYTES) {
+            if (RESET == KV_IsBlank(u32Addr, EFM_PGM_UNIT_BYTES)) {
+                u32DataEnd = u32Addr + EFM_PGM_UNIT_BYTES;
+            }
+        }
+        pstcKv->u32ActiveSector = u32Sector;
+        pstcKv->u32Seq = pstcSector->u32Seq;
+        pstcKv->u32WriteAddr = u32DataEnd;
+        pstcKv->u32EntryAddr = u32Entry;
+    }
+    pstcKv->u32OldestSector = u32Oldest;
+    pstcKv->u32UsedSectorNum = u32Used;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Erase the key-value store and start with an empty one.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure with the first four members set.
+ * @retval int32_t:
+ *         - LL_OK:                     Format successfully.
+ *         - LL_ERR_INVD_PARAM:         pstcKv == NULL or pstcKv->pu32Index == NULL.
+ *         - LL_ERR:                    Erase or program failed.
+ */
+int32_t EFM_KV_Format(stc_efm_kv_t *pstcKv)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t i;
+
+    if ((NULL == pstcKv) || (NULL == pstcKv->pu32Index)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    for (i = 0UL; (i < pstcKv->u32SectorNum) && (LL_OK == i32Ret); i++) {
+        if (RESET == KV_IsBlank(EFM_KV_SECTOR_START(pstcKv, i), EFM_SECTOR_SIZE)) {
+            i32Ret = EFM_SectorErase(EFM_KV_SECTOR_START(pstcKv, i));
+        }
+    }
+    for (i = 0UL; i < pstcKv->u32IndexSize; i++) {
+        pstcKv->pu32Index[i] = EFM_KV_INDEX_EMPTY;
+    }
+    pstcKv->u32KeyCount = 0UL;
+    pstcKv->u32GcAddr = 0UL;
+    pstcKv->u32UsedSectorNum = 0UL;
+    pstcKv->u32Seq = 0UL;
+    if (LL_OK == i32Ret) {
+        i32Ret = KV_OpenSector(pstcKv, 0UL);
+    }
+    pstcKv->u32OldestSector = 0UL;
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Write the value of a key.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] u32Key                  The key, any value except EFM_KV_KEY_INVD.
+ * @param  [in] pvData                  Pointer to the value.
+ * @param  [in] u16Len                  Length of the value in bytes, up to EFM_KV_DATA_SIZE_MAX.
+ * @retval int32_t:
+ *         - LL_OK:                     Write successfully, or the value is unchanged.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter.
+ *         - LL_ERR_BUF_FULL:           No space left in flash or in the index.
+ *         - LL_ERR:                    Erase or program failed.
+ * @note   The oldest sector is collected here when the store runs out of free sectors, call
+ *         EFM_KV_GcStep() in the idle time to avoid it.
+ */
+int32_t EFM_KV_Set(stc_efm_kv_t *pstcKv, uint32_t u32Key, const void *pvData, uint16_t u16Len)
+{
+    stc_kv_entry_t stcEntry;
+    const stc_kv_entry_t *pstcOld;
+    const uint8_t *pu8Old;
+    const uint8_t *pu8New = (const uint8_t *)pvData;
+    uint32_t u32Entry;
+    uint32_t i;
+
+    if ((NULL == pstcKv) || (EFM_KV_KEY_INVD == u32Key) || (u16Len > EFM_KV_DATA_SIZE_MAX) ||
+        ((NULL == pvData) && (0U != u16Len))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32Entry = pstcKv->pu32Index[KV_IndexFind(pstcKv, u32Key)];
+    if (EFM_KV_INDEX_EMPTY == u32Entry) {
+        if ((pstcKv->u32KeyCount + 1UL) >= pstcKv->u32IndexSize) {
+            return LL_ERR_BUF_FULL;
+        }
+    } else {
+        /* Skip the write if the value is unchanged */
+        pstcOld = (const stc_kv_entry_t *)u32Entry;
+        if ((EFM_KV_FLAG_VALID == pstcOld->u16Flag) && (u16Len == pstcOld->u16Len)) {
+            pu8Old = (const uint8_t *)EFM_KV_ENTRY_DATA(u32Entry);
+            i = 0UL;
+            while ((i < u16Len) && (pu8Old[i] == pu8New[i])) {
+                i++;
+            }
+            if (i == u16Len) {
+                return LL_OK;
+            }
+        }
+    }
+
+    stcEntry.u32Key = u32Key;
+    stcEntry.u16Len = u16Len;
+    stcEntry.u16Flag = EFM_KV_FLAG_VALID;
+    stcEntry.u16Offset = 0U;
+    stcEntry.u16Rsvd = 0xFFFFU;
+    stcEntry.u32Crc = KV_CalcCrc(&stcEntry, pvData);
+
+    return KV_Write(pstcKv, &stcEntry, pvData);
+}
+
+/**
+ * @brief  Read the value of a key.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] u32Key                  The key.
+ * @param  [out] pvData                 Buffer for the value, can be NULL if u16Size is 0.
+ * @param  [in] u16Size                 Size of the buffer in bytes.
+ * @param  [out] pu16Len                Length of the value, can be NULL.
+ * @retval int32_t:
+ *         - LL_OK:                     Read successfully.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter, or the buffer is smaller than the value.
+ *         - LL_ERR:                    The key does not exist.
+ */
+int32_t EFM_KV_Get(const stc_efm_kv_t *pstcKv, uint32_t u32Key, void *pvData, uint16_t u16Size, uint16_t *pu16Len)
+{
+    const stc_kv_entry_t *pstcEntry;
+    const uint8_t *pu8Src;
+    uint8_t *pu8Dest = (uint8_t *)pvData;
+    uint32_t u32Entry;
+    uint32_t i;
+
+    if ((NULL == pstcKv) || (EFM_KV_KEY_INVD == u32Key) || ((NULL == pvData) && (0U != u16Size))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32Entry = pstcKv->pu32Index[KV_IndexFind(pstcKv, u32Key)];
+    if (EFM_KV_INDEX_EMPTY == u32Entry) {
+        return LL_ERR;
+    }
+    pstcEntry = (const stc_kv_entry_t *)u32Entry;
+    if (EFM_KV_FLAG_VALID != pstcEntry->u16Flag) {
+        return LL_ERR;
+    }
+    if (NULL != pu16Len) {
+        *pu16Len = pstcEntry->u16Len;
+    }
+    if (pstcEntry->u16Len > u16Size) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pu8Src = (const uint8_t *)EFM_KV_ENTRY_DATA(u32Entry);
+    for (i = 0UL; i < pstcEntry->u16Len; i++) {
+        pu8Dest[i] = pu8Src[i];
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Delete a key.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @param  [in] u32Key                  The key.
+ * @retval int32_t:
+ *         - LL_OK:                     Delete successfully, or the key does not exist.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter.
+ *         - LL_ERR_BUF_FULL:           No space left in flash.
+ *         - LL_ERR:                    Erase or program failed.
+ * @note   A delete record is written, the key leaves the index when the record is collected.
+ */
+int32_t EFM_KV_Delete(stc_efm_kv_t *pstcKv, uint32_t u32Key)
+{
+    stc_kv_entry_t stcEntry;
+    uint32_t u32Entry;
+
+    if ((NULL == pstcKv) || (EFM_KV_KEY_INVD == u32Key)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32Entry = pstcKv->pu32Index[KV_IndexFind(pstcKv, u32Key)];
+    if ((EFM_KV_INDEX_EMPTY == u32Entry) || (EFM_KV_FLAG_VALID != ((const stc_kv_entry_t *)u32Entry)->u16Flag)) {
+        return LL_OK;
+    }
+
+    stcEntry.u32Key = u32Key;
+    stcEntry.u16Len = 0U;
+    stcEntry.u16Flag = EFM_KV_FLAG_DELETED;
+    stcEntry.u16Offset = 0U;
+    stcEntry.u16Rsvd = 0xFFFFU;
+    stcEntry.u32Crc = KV_CalcCrc(&stcEntry, NULL);
+
+    return KV_Write(pstcKv, &stcEntry, NULL);
+}
+
+/**
+ * @brief  Run one step of the background garbage collection.
+ * @param  [in] pstcKv                  Pointer to a @ref stc_efm_kv_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                     One record collected, or nothing to do.
+ *         - LL_ERR_INVD_PARAM:         pstcKv == NULL.
+ *         - LL_ERR_BUF_FULL:           No space left to move the live records.
+ *         - LL_ERR:                    Erase or program failed.
+ * @note   Call it in the idle time. It collects the oldest sector when less than EFM_KV_GC_THRESHOLD
+ *         sectors are free, one record per call and the sector erase in the last call.
+ */
+int32_t EFM_KV_GcStep(stc_efm_kv_t *pstcKv)
+{
+    if (NULL == pstcKv) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (0UL == pstcKv->u32GcAddr) {
+        if (((pstcKv->u32SectorNum - pstcKv->u32UsedSectorNum) >= EFM_KV_GC_THRESHOLD) ||
+            (pstcKv->u32UsedSectorNum < 2UL)) {
+            return LL_OK;
+        }
+        pstcKv->u32GcAddr = EFM_KV_FIRST_ENTRY(pstcKv, pstcKv->u32OldestSector);
+    }
+
+    return KV_GcRecord(pstcKv);
+}
+#endif /* LL_CRC_ENABLE */
+#if (LL_HASH_ENABLE == DDL_ON)
+/**
+ * @brief  Program image data into the inactive bank, the sectors are erased ahead of the data.
+ * @param  [in] pstcUpdate              Pointer to a @ref stc_efm_fw_update_t structure.
+ * @param  [in] u32Addr                 Program address, program unit aligned.
+ * @param  [in] pu8Data                 Pointer to the data.
+ * @param  [in] u32Len                  Length of the data in bytes.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t FW_Program(stc_efm_fw_update_t *pstcUpdate, uint32_t u32Addr, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    int32_t i32Ret = LL_OK;
+
+    while ((LL_OK == i32Ret) && (pstcUpdate->u32EraseAddr < (u32Addr + u32Len))) {
+        i32Ret = EFM_SectorErase(pstcUpdate->u32EraseAddr);
+        pstcUpdate->u32EraseAddr += EFM_SECTOR_SIZE;
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_SequenceProgram(u32Addr, pu8Data, u32Len);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Program a state mark of the image trailer.
+ * @param  [in] u32Addr                 Address of the mark, program unit aligned.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t FW_ProgramMark(uint32_t u32Addr)
+{
+    const uint32_t au32Mark[EFM_PGM_UNIT_WORDS] = {0UL};
+    int32_t i32Ret;
+
+    EFM_SingleSectorOperateCmd((uint8_t)(u32Addr / EFM_SECTOR_SIZE), ENABLE);
+    i32Ret = EFM_Program(u32Addr, (const uint8_t *)au32Mark, EFM_PGM_UNIT_BYTES);
+    EFM_SingleSectorOperateCmd((uint8_t)(u32Addr / EFM_SECTOR_SIZE), DISABLE);
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start an A/B firmware update into the inactive bank.
+ * @param  [out] pstcUpdate             Pointer to a @ref stc_efm_fw_update_t structure.
+ * @param  [in] u32ImageSize            Size of the image in bytes, up to EFM_FW_IMAGE_SIZE_MAX.
+ * @retval int32_t:
+ *         - LL_OK:                     Start successfully.
+ *         - LL_ERR_INVD_PARAM:         pstcUpdate == NULL or invalid image size.
+ *         - LL_ERR_INVD_MD:            The OTP function is enabled, the banks cannot be swapped as a whole.
+ *         - LL_ERR:                    Erase failed.
+ * @note   1)Call EFM_REG_Unlock() and EFM_FWMC_Cmd(ENABLE) first.
+ *         2)The inactive bank is always mapped at EFM_FLASH_1_START_ADDR, it is write enabled until
+ *           EFM_FW_UpdateFinish() or EFM_FW_UpdateAbort().
+ */
+int32_t EFM_FW_UpdateStart(stc_efm_fw_update_t *pstcUpdate, uint32_t u32ImageSize)
+{
+    int32_t i32Ret;
+
+    if ((NULL == pstcUpdate) || (0UL == u32ImageSize) || (u32ImageSize > EFM_FW_IMAGE_SIZE_MAX)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (SET == EFM_GetOTPStatus()) {
+        return LL_ERR_INVD_MD;
+    }
+
+    pstcUpdate->u32ImageSize = u32ImageSize;
+    pstcUpdate->u32Offset = 0UL;
+    pstcUpdate->u32EraseAddr = EFM_FW_INACTIVE_BANK;
+    EFM_SequenceSectorOperateCmd(EFM_FLASH1_START_SECTOR_NUM, EFM_FW_BANK_SECTOR_NUM, ENABLE);
+    /* Invalidate the old image first, a half written image is never swapped in */
+    i32Ret = EFM_SectorErase(EFM_FW_TRAILER_ADDR(EFM_FW_INACTIVE_BANK));
+    if (LL_OK != i32Ret) {
+        EFM_SequenceSectorOperateCmd(EFM_FLASH1_START_SECTOR_NUM, EFM_FW_BANK_SECTOR_NUM, DISABLE);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Write the next part of the image, parts of any size can be streamed in.
+ * @param  [in] pstcUpdate              Pointer to a @ref stc_efm_fw_update_t structure.
+ * @param  [in] pu8Data                 Pointer to the image data.
+ * @param  [in] u32Len                  Length of the data in bytes.
+ * @retval int32_t:
+ *         - LL_OK:                     Write successfully.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter, or the data exceeds the image size.
+ *         - LL_ERR:                    Erase or program failed.
+ * @note   Whole program units are programmed from pu8Data directly, only an incomplete unit is
+ *         kept in pstcUpdate until the next call.
+ */
+int32_t EFM_FW_UpdateWrite(stc_efm_fw_update_t *pstcUpdate, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Index = 0UL;
+    uint32_t u32Pending;
+    uint32_t u32Addr;
+    uint32_t u32Size;
+    uint32_t i;
+
+    if ((NULL == pstcUpdate) || (NULL == pu8Data) ||
+        (u32Len > (pstcUpdate->u32ImageSize - pstcUpdate->u32Offset))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    while ((LL_OK == i32Ret) && (u32Len > 0UL)) {
+        u32Pending = pstcUpdate->u32Offset % EFM_PGM_UNIT_BYTES;
+        u32Addr = EFM_FW_INACTIVE_BANK + pstcUpdate->u32Offset - u32Pending;
+        if ((0UL == u32Pending) && (u32Len >= EFM_PGM_UNIT_BYTES)) {
+            u32Size = u32Len & ~(EFM_PGM_UNIT_BYTES - 1UL);
+            i32Ret = FW_Program(pstcUpdate, u32Addr, &pu8Data[u32Index], u32Size);
+        } else {
+            u32Size = LL_MIN(EFM_PGM_UNIT_BYTES - u32Pending, u32Len);
+            for (i = 0UL; i < u32Size; i++) {
+                pstcUpdate->au8Unit[u32Pending + i] = pu8Data[u32Index + i];
+            }
+            if ((u32Pending + u32Size) == EFM_PGM_UNIT_BYTES) {
+                i32Ret = FW_Program(pstcUpdate, u32Addr, pstcUpdate->au8Unit, EFM_PGM_UNIT_BYTES);
+            }
+        }
+        if (LL_OK == i32Ret) {
+            pstcUpdate->u32Offset += u32Size;
+            u32Index += u32Size;
+            u32Len -= u32Size;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Verify the written image and swap it in.
+ * @param  [in] pstcUpdate              Pointer to a @ref stc_efm_fw_update_t structure.
+ * @param  [in] pu8Digest               Expected SHA256 digest of the image, 32 bytes.
+ * @retval int32_t:
+ *         - LL_OK:                     The image is swapped in, reset the chip to boot it.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter, or the image is incomplete.
+ *         - LL_ERR:                    The digest does not match, or program failed.
+ *         - LL_ERR_TIMEOUT:            HASH timeout.
+ * @note   1)The HASH is calculated over the inactive bank in place, enable the HASH clock first.
+ *         2)The new image boots on trial, see EFM_FW_BootCheck().
+ */
+int32_t EFM_FW_UpdateFinish(stc_efm_fw_update_t *pstcUpdate, const uint8_t *pu8Digest)
+{
+    int32_t i32Ret = LL_OK;
+    stc_fw_trailer_t stcTrailer;
+    uint32_t u32Pending;
+    uint32_t i;
+
+    if ((NULL == pstcUpdate) || (NULL == pu8Digest) || (pstcUpdate->u32Offset != pstcUpdate->u32ImageSize)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32Pending = pstcUpdate->u32Offset % EFM_PGM_UNIT_BYTES;
+    if (0UL != u32Pending) {
+        i32Ret = FW_Program(pstcUpdate, EFM_FW_INACTIVE_BANK + pstcUpdate->u32Offset - u32Pending,
+                            pstcUpdate->au8Unit, u32Pending);
+    }
+    if (LL_OK == i32Ret) {
+        /* Drop the cache lines of the old image */
+        EFM_CacheRamReset(ENABLE);
+        EFM_CacheRamReset(DISABLE);
+        i32Ret = HASH_Calculate((const uint8_t *)EFM_FW_INACTIVE_BANK, pstcUpdate->u32ImageSize, stcTrailer.au8Digest);
+    }
+    for (i = 0UL; (LL_OK == i32Ret) && (i < EFM_FW_DIGEST_SIZE); i++) {
+        if (stcTrailer.au8Digest[i] != pu8Digest[i]) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        stcTrailer.u32Magic = EFM_FW_MAGIC;
+        stcTrailer.u32ImageSize = pstcUpdate->u32ImageSize;
+        stcTrailer.au32Rsvd[0] = 0xFFFFFFFFUL;
+        stcTrailer.au32Rsvd[1] = 0xFFFFFFFFUL;
+        i32Ret = EFM_Program(EFM_FW_TRAILER_ADDR(EFM_FW_INACTIVE_BANK), (const uint8_t *)&stcTrailer,
+                             sizeof(stc_fw_trailer_t));
+    }
+    EFM_SequenceSectorOperateCmd(EFM_FLASH1_START_SECTOR_NUM, EFM_FW_BANK_SECTOR_NUM, DISABLE);
+    if (LL_OK == i32Ret) {
+        /* Setting the swap is a single program, clearing it a single erase, a power loss keeps either bank */
+        i32Ret = EFM_SwapCmd((SET == EFM_GetSwapStatus()) ? DISABLE : ENABLE);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Abort an A/B firmware update, the running image is kept.
+ * @param  [in] pstcUpdate              Pointer to a @ref stc_efm_fw_update_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                     Abort successfully.
+ *         - LL_ERR_INVD_PARAM:         pstcUpdate == NULL.
+ */
+int32_t EFM_FW_UpdateAbort(stc_efm_fw_update_t *pstcUpdate)
+{
+    if (NULL == pstcUpdate) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcUpdate->u32Offset = 0UL;
+    pstcUpdate->u32ImageSize = 0UL;
+    EFM_SequenceSectorOperateCmd(EFM_FLASH1_START_SECTOR_NUM, EFM_FW_BANK_SECTOR_NUM, DISABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Count a trial boot of a new image, and roll back when the trial boots are used up.
+ * @param  [in] u32AttemptMax           Number of trial boots before the rollback, 1 ~ EFM_FW_BOOT_ATTEMPT_MAX.
+ * @retval int32_t:
+ *         - LL_OK:                     Continue to boot the running image.
+ *         - LL_ERR_NOT_RDY:            The new image was not confirmed in time and the swap is flipped back,
+ *                                      reset the chip to boot the previous image.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter.
+ *         - LL_ERR:                    Program failed.
+ * @note   1)Call it early in each boot, after EFM_REG_Unlock() and EFM_FWMC_Cmd(ENABLE).
+ *         2)Call EFM_FW_Confirm() once the new image runs well, the trial ends then.
+ */
+int32_t EFM_FW_BootCheck(uint32_t u32AttemptMax)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Trailer = EFM_FW_TRAILER_ADDR(EFM_FW_ACTIVE_BANK);
+    uint32_t u32Addr = u32Trailer + EFM_FW_ATTEMPT_OFFSET;
+    uint32_t u32Count = 0UL;
+
+    if ((0UL == u32AttemptMax) || (u32AttemptMax > EFM_FW_BOOT_ATTEMPT_MAX)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    /* Images not written by the update, and confirmed images are not on trial */
+    if ((SET == EFM_GetOTPStatus()) || (EFM_FW_MAGIC != ((const stc_fw_trailer_t *)u32Trailer)->u32Magic) ||
+        (0xFFFFFFFFUL != RW_MEM32(u32Trailer + EFM_FW_CONFIRM_OFFSET))) {
+        return LL_OK;
+    }
+
+    while ((u32Count < u32AttemptMax) && (0xFFFFFFFFUL != RW_MEM32(u32Addr))) {
+        u32Count++;
+        u32Addr += EFM_PGM_UNIT_BYTES;
+    }
+    if (u32Count >= u32AttemptMax) {
+        i32Ret = EFM_SwapCmd((SET == EFM_GetSwapStatus()) ? DISABLE : ENABLE);
+        if (LL_OK == i32Ret) {
+            i32Ret = LL_ERR_NOT_RDY;
+        }
+    } else {
+        i32Ret = FW_ProgramMark(u32Addr);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Confirm the running image, it is not rolled back any more.
+ * @param  None
+ * @retval int32_t:
+ *         - LL_OK:                     Confirm successfully, or the image is not on trial.
+ *         - LL_ERR:                    Program failed.
+ * @note   Call EFM_REG_Unlock() and EFM_FWMC_Cmd(ENABLE) first.
+ */
+int32_t EFM_FW_Confirm(void)
+{
+    uint32_t u32Trailer = EFM_FW_TRAILER_ADDR(EFM_FW_ACTIVE_BANK);
+
+    if ((SET == EFM_GetOTPStatus()) || (EFM_FW_MAGIC != ((const stc_fw_trailer_t *)u32Trailer)->u32Magic) ||
+        (0xFFFFFFFFUL != RW_MEM32(u32Trailer + EFM_FW_CONFIRM_OFFSET))) {
+        return LL_OK;
+    }
+
+    return FW_ProgramMark(u32Trailer + EFM_FW_CONFIRM_OFFSET);
+}
+#endif /* LL_HASH_ENABLE */
+
+/**
+ * @brief  FWMC register write enable or disable.
+ * @param  [in] enNewState                An @ref en_functional_state_t enumeration value.
+ * @retval None
+ */
+void EFM_FWMC_Cmd(en_functional_state_t enNewState)
+{
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (ENABLE == enNewState) {
+        WRITE_REG32(CM_EFM->KEY1, 0x01234567UL);
+        WRITE_REG32(CM_EFM->KEY1, 0xFEDCBA98UL);
+    } else {
+        SET_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_KEY1LOCK);
+    }
+}
+
+/**
+ * @brief  Get chip ID.
+ * @param  None
+ * @retval Returns the value of the Chip ID
+ */
+uint32_t EFM_GetCID(void)
+{
+    return READ_REG32(CM_EFM->CHIPID);
+}
+/**
+ * @brief  EFM OTP operate unlock.
+ * @param  None
+ * @retval None
+ * @note   Call EFM_REG_Unlock() unlock EFM register first.
+ */
+void EFM_OTP_WP_Unlock(void)
+{
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+
+    WRITE_REG32(CM_EFM->KEY2, EFM_OTP_UNLOCK_KEY1);
+    WRITE_REG32(CM_EFM->KEY2, EFM_OTP_UNLOCK_KEY2);
+}
+
+/**
+ * @brief  EFM OTP write protect lock.
+ * @param  None
+ * @retval None
+ */
+void EFM_OTP_WP_Lock(void)
+{
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+
+    SET_REG32_BIT(CM_EFM->FWMC, EFM_FWMC_KEY2LOCK);
+}
+
+/**
+ * @brief  Enable OTP Function
+ * @param  None
+ * @retval Function execution status @ref Generic_Error_Codes
+ *         - LL_OK:                     Success
+ *         - LL_ERR:                    Fail
+ */
+int32_t EFM_OTP_Enable(void)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32EnableCode[4] = {0UL};
+
+    DDL_ASSERT(IS_EFM_OTP_UNLOCK());
+
+    if (EFM_GetOTPStatus() == SET) {
+        return i32Ret;
+    }
+    i32Ret = Program_Implement(EFM_OTP_ENABLE_ADDR,
+                               (uint8_t *)u32EnableCode,
+                               EFM_PGM_UNIT_BYTES,
+                               EFM_MD_PGM_SINGLE);
+    return i32Ret;
+}
+
+/**
+ * @brief  Set block OTP by the lock address of block
+ * @param  [in]  u32Addr   The lock address of block @ref EFM_OTP_BLOCK_LOCKADDR
+ * @retval Function execution status @ref Generic_Error_Codes
+ *         - LL_OK:                     Success
+ *         - LL_ERR:                    Fail
+ */
+int32_t EFM_OTP_Lock(uint32_t u32Addr)
+{
+    int32_t i32Ret;
+    uint32_t u32LockCode[4] = {0UL};
+
+    DDL_ASSERT(IS_EFM_OTP_UNLOCK());
+    DDL_ASSERT((u32Addr >= EFM_OTP_LOCK_ADDR_START) && (u32Addr < EFM_OTP_LOCK_ADDR_END));
+
+    i32Ret = Program_Implement(u32Addr,
+                               (uint8_t *)u32LockCode,
+                               EFM_PGM_UNIT_BYTES,
+                               EFM_MD_PGM_SINGLE);
+    return i32Ret;
+}
+
+/**
+ * @brief  Set block OTP by a range of block index
+ * @param  [in]  u32BlockStartIdx       Start block index,range from 0 to @ref EFM_OTP_BLOCK_IDX_MAX
+ * @param  [in]  u16Count               Number of block(s) starting from u32BlockStartIdx
+ * @retval Function execution status @ref Generic_Error_Codes
+ *         - LL_OK:                     Success
+ *         - LL_ERR:                    Fail
+ */
+int32_t EFM_OTP_LockBlock(uint32_t u32BlockStartIdx, uint16_t u16Count)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t i, j;
+    uint32_t u32ReadAcclCmd = READ_REG32_BIT(CM_EFM->FRMC, EFM_RD_ACCL_CMD_ALL);
+    uint32_t *pu32LockAddr;
+    uint32_t u32EndIdx = u32BlockStartIdx + u16Count - 1U;
+
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+    DDL_ASSERT(IS_EFM_FWMC_UNLOCK());
+    DDL_ASSERT((EFM_FLAG_RDY) == READ_REG32_BIT(CM_EFM->FSR, (EFM_FLAG_RDY)));
+    DDL_ASSERT((EFM_FLAG_RDY1) == READ_REG32_BIT(CM_EFM->FSR, (EFM_FLAG_RDY1)));
+    DDL_ASSERT(IS_EFM_OTP_UNLOCK());
+    DDL_ASSERT(u32EndIdx <= EFM_OTP_BLOCK_IDX_MAX);
+    DDL_ASSERT(u32BlockStartIdx <= u32EndIdx);
+
+    /*Prepare Program*/
+    CLR_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
+    SET_REG32_BIT(CM_EFM->FSCLR, EFM_FLAG_WRITE);
+
+    /*Program lock code*/
+    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_SINGLE);
+    for (i = u32BlockStartIdx; i <= u32EndIdx; i++) {
+        pu32LockAddr = (uint32_t *)EFM_OTP_BLOCK_LOCKADDR(i);
+        for (j = 0U; j < EFM_PGM_UNIT_WORDS; j++) {
+            *pu32LockAddr++ = 0UL;
+        }
+        if (i32Ret != WaitAndClearOPTEndFlag(EFM_FLAG0_POS)) {
+            break;
+        }
+    }
+    MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
+
+    /* Recover read accelerator cmd */
+    MODIFY_REG32(CM_EFM->FRMC, EFM_CACHE_ALL, u32ReadAcclCmd);
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get otp enabled or disabled status
+ * @param  None
+ * @retval en_flag_status_t:
+ *         - SET:                       OTP enabled
+ *         - RESET:                     OTP disable
+ */
+en_flag_status_t EFM_GetOTPStatus(void)
+{
+    return GetOTPStatus();
+}
+
+/**
+ * @brief  Sector protected register lock.
+ * @param  [in] u32RegLock                      Specifies sector protected register locking.
+ *  @arg   EFM_WRLOCK0 ~ EFM_WRLOCK7
+ * @retval None
+ * @note   Call EFM_REG_Unlock() unlock EFM register first.
+ */
+void EFM_SectorProtectRegLock(uint32_t u32RegLock)
+{
+    DDL_ASSERT(IS_EFM_SECTOR_PROTECT_REG_LOCK(u32RegLock));
+    DDL_ASSERT(IS_EFM_REG_UNLOCK());
+
+    SET_REG32_BIT(CM_EFM->WLOCK, u32RegLock);
+}
+
+/**
+ * @brief  Set sector lock or unlock (Single).
+ * @param  [in] u8SectorNum     Specifies sector for unlock.
+ *                              This parameter can be set 0~255.
+ *                              see the macro definition for @ref EFM_Sector_Count
+ * @param  [in] enNewState      An @ref en_functional_state_t enumeration value.
+ * @retval None
+ * @note   Call EFM_REG_Unlock() unlock EFM register first.
+ *         If you want to unlock sequence sectors,Please call EFM_SequenceSectorOperateCmd function
+ */
+void EFM_SingleSectorOperateCmd(uint8_t u8SectorNum, en_functional_state_t enNewState)
+{
+    __IO uint32_t *EFM_FxNWPRTy;
     uint8_t u8RegIndex;
     uint8_t u8BitPos;
 
@@ -2155,6 +3507,203 @@ void EFM_ECC_ErrorInjectBitCmd(uint32_t u32Chip, const stc_efm_ecc_err_inject_bi
         }
     }
 }
+
+/**
+ * @brief  Get the flash address of an ECC error record.
+ * @param  [in]  pstcRecord             Pointer to a @ref stc_efm_ecc_err_record_t structure.
+ * @retval The flash address.
+ */
+static uint32_t ECC_RecordToAddr(const stc_efm_ecc_err_record_t *pstcRecord)
+{
+    uint32_t u32Addr = pstcRecord->u32AddrOffset;
+    en_flag_status_t enChip1 = (EFM_CHIP1 == pstcRecord->u32EfmChip) ? SET : RESET;
+
+    /* The whole chips are swapped, or only the first 128KB if OTP is enabled */
+    if ((SET == EFM_GetSwapStatus()) && ((RESET == EFM_GetOTPStatus()) || (u32Addr <= EFM_OTP_END_ADDR1))) {
+        enChip1 = (SET == enChip1) ? RESET : SET;
+    }
+
+    return (SET == enChip1) ? (EFM_FLASH_1_START_ADDR + u32Addr) : u32Addr;
+}
+
+/**
+ * @brief  Collect the ECC error records into the scrubber telemetry.
+ * @param  [in]  pstcScrub              Pointer to a @ref stc_efm_ecc_scrub_t structure.
+ * @param  [in]  u32Sector              Start address of the sector being scrubbed.
+ * @retval None
+ */
+static void ECC_ScrubCollect(stc_efm_ecc_scrub_t *pstcScrub, uint32_t u32Sector)
+{
+    const stc_efm_ecc_err_record_t *pstcRecord;
+    uint32_t u32Addr;
+    uint32_t i;
+
+    if (SET == EFM_GetAnyStatus(EFM_FLAG_ECC)) {
+        pstcScrub->u32OverflowCount++;
+        EFM_ClearStatus(EFM_FLAG_ECC);
+    }
+
+    pstcRecord = EFM_ECC_GetErrorRecord(EFM_CHIP_ALL, EFM_ECC_ERR_REC_ALL);
+    for (i = 0UL; i < (EFM_CHIP_COUNT * EFM_ECC_ERR_RECORD_COUNT); i++) {
+        if ((1U == pstcRecord[i].u32IsValid) && (0U == pstcRecord[i].u32IsRescueSector) &&
+            (0U == pstcRecord[i].u32IsSpecialFuncSector)) {
+            u32Addr = ECC_RecordToAddr(&pstcRecord[i]);
+            if (1U == pstcRecord[i].u32IsFatal) {
+                pstcScrub->u32FatalCount++;
+                pstcScrub->au32ErrAddr[pstcScrub->u32LogCount % EFM_ECC_SCRUB_LOG_SIZE] = u32Addr | EFM_ECC_SCRUB_LOG_FATAL;
+            } else {
+                pstcScrub->u32CorrectedCount++;
+                pstcScrub->au32ErrAddr[pstcScrub->u32LogCount % EFM_ECC_SCRUB_LOG_SIZE] = u32Addr;
+                if ((u32Addr >= u32Sector) && (u32Addr < (u32Sector + EFM_SECTOR_SIZE))) {
+                    pstcScrub->u32SectorErrCount++;
+                }
+            }
+            pstcScrub->u32LogCount++;
+        }
+    }
+
+    EFM_ECC_ClearErrorRecord(EFM_CHIP_ALL, EFM_ECC_ERR_REC_ALL);
+    EFM_ClearCheckStatus(EFM_CHECK_FLAG_ECC_ALL);
+}
+
+/**
+ * @brief  Rewrite a degrading sector with its corrected data.
+ * @param  [in]  pstcScrub              Pointer to a @ref stc_efm_ecc_scrub_t structure.
+ * @retval An @ref Generic_Error_Codes enumeration type value.
+ */
+static int32_t ECC_ScrubRewrite(stc_efm_ecc_scrub_t *pstcScrub)
+{
+    int32_t i32Ret;
+    uint32_t u32Sector = pstcScrub->u32RewriteAddr;
+    uint8_t u8SectorNum = (uint8_t)(u32Sector / EFM_SECTOR_SIZE);
+    const uint32_t *pu32Unit;
+    uint32_t i;
+
+    /* Reads return the corrected data */
+    for (i = 0UL; i < EFM_SECTOR_SIZE; i++) {
+        pstcScrub->pu8Buf[i] = *(const uint8_t *)(u32Sector + i);
+    }
+
+    EFM_SingleSectorOperateCmd(u8SectorNum, ENABLE);
+    i32Ret = EFM_SectorErase(u32Sector);
+    for (i = 0UL; (i < EFM_SECTOR_SIZE) && (LL_OK == i32Ret); i += EFM_PGM_UNIT_BYTES) {
+        pu32Unit = (const uint32_t *)(uint32_t)&pstcScrub->pu8Buf[i];
+        /* Blank units stay blank, so they can still be programmed by their owner */
+        if ((0xFFFFFFFFUL != pu32Unit[0]) || (0xFFFFFFFFUL != pu32Unit[1]) ||
+            (0xFFFFFFFFUL != pu32Unit[2]) || (0xFFFFFFFFUL != pu32Unit[3])) {
+            i32Ret = EFM_Program(u32Sector + i, &pstcScrub->pu8Buf[i], EFM_PGM_UNIT_BYTES);
+        }
+    }
+    EFM_SingleSectorOperateCmd(u8SectorNum, DISABLE);
+
+    for (i = 0UL; (i < EFM_SECTOR_SIZE) && (LL_OK == i32Ret); i++) {
+        if (pstcScrub->pu8Buf[i] != *(const uint8_t *)(u32Sector + i)) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        pstcScrub->u32RewriteCount++;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the ECC scrubber.
+ * @param  [in,out] pstcScrub           Pointer to a @ref stc_efm_ecc_scrub_t structure with the first
+ *                                      five members set, the others are cleared here.
+ * @retval int32_t:
+ *         - LL_OK:                     Initialize successfully.
+ *         - LL_ERR_INVD_PARAM:         Invalid parameter.
+ * @note   Configure the ECC with EFM_ECC_MD2 or EFM_ECC_MD3 by EFM_ECC_Config(), EFM_ECC_MD1 does not
+ *         record the corrected errors. An uncorrectable error met by the scrubber raises the NMI or
+ *         reset selected there as any other read does.
+ */
+int32_t EFM_ECC_ScrubInit(stc_efm_ecc_scrub_t *pstcScrub)
+{
+    uint32_t i;
+
+    if ((NULL == pstcScrub) || (0UL == pstcScrub->u32UnitsPerStep) || (0UL == pstcScrub->u32RewriteThreshold) ||
+        (!IS_ADDR_ALIGN(pstcScrub->u32StartAddr, EFM_SECTOR_SIZE)) ||
+        (!IS_ADDR_ALIGN(pstcScrub->u32EndAddr, EFM_SECTOR_SIZE)) ||
+        (pstcScrub->u32StartAddr >= pstcScrub->u32EndAddr) || ((pstcScrub->u32EndAddr - 1UL) > EFM_END_ADDR)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcScrub->u32Addr = pstcScrub->u32StartAddr;
+    pstcScrub->u32RewriteAddr = EFM_ECC_SCRUB_ADDR_NONE;
+    pstcScrub->u32SectorErrCount = 0UL;
+    pstcScrub->u32PassCount = 0UL;
+    pstcScrub->u32CorrectedCount = 0UL;
+    pstcScrub->u32FatalCount = 0UL;
+    pstcScrub->u32OverflowCount = 0UL;
+    pstcScrub->u32RewriteCount = 0UL;
+    pstcScrub->u32LogCount = 0UL;
+    for (i = 0UL; i < EFM_ECC_SCRUB_LOG_SIZE; i++) {
+        pstcScrub->au32ErrAddr[i] = 0UL;
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Run one step of the ECC scrubber.
+ * @param  [in,out] pstcScrub           Pointer to a @ref stc_efm_ecc_scrub_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                     Step done.
+ *         - LL_ERR_INVD_PARAM:         pstcScrub == NULL.
+ *         - LL_ERR:                    The sector rewrite failed.
+ * @note   1)Call it periodically from a low priority context. Each call reads u32UnitsPerStep program
+ *           units around the data cache and collects the ECC error records, e.g. 256 units per
+ *           millisecond take well under 1% of a 240MHz CPU.
+ *         2)A sector with at least u32RewriteThreshold corrected errors in one pass is rewritten in the
+ *           next call if pu8Buf is set. The rewrite blocks for the sector erase and program, call
+ *           EFM_REG_Unlock() and EFM_FWMC_Cmd(ENABLE) first. Exclude the sectors holding the running
+ *           code and the sectors owned by EFM_KV_Init() or EFM_AsyncSubmit() from the range, and note
+ *           that a power loss during the rewrite loses the sector.
+ */
+int32_t EFM_ECC_ScrubStep(stc_efm_ecc_scrub_t *pstcScrub)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Sector;
+    uint32_t u32End;
+    uint32_t u32Dcache;
+
+    if (NULL == pstcScrub) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (EFM_ECC_SCRUB_ADDR_NONE != pstcScrub->u32RewriteAddr) {
+        i32Ret = ECC_ScrubRewrite(pstcScrub);
+        pstcScrub->u32RewriteAddr = EFM_ECC_SCRUB_ADDR_NONE;
+        return i32Ret;
+    }
+
+    u32Sector = pstcScrub->u32Addr & ~(EFM_SECTOR_SIZE - 1UL);
+    u32End = LL_MIN(u32Sector + EFM_SECTOR_SIZE, pstcScrub->u32Addr + (pstcScrub->u32UnitsPerStep * EFM_PGM_UNIT_BYTES));
+    /* One read checks the ECC of a whole program unit */
+    u32Dcache = READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_DCACHE);
+    CLR_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_DCACHE);
+    while (pstcScrub->u32Addr < u32End) {
+        (void)RW_MEM32(pstcScrub->u32Addr);
+        pstcScrub->u32Addr += EFM_PGM_UNIT_BYTES;
+    }
+    SET_REG32_BIT(CM_EFM->FRMC, u32Dcache);
+    ECC_ScrubCollect(pstcScrub, u32Sector);
+
+    if (pstcScrub->u32Addr >= (u32Sector + EFM_SECTOR_SIZE)) {
+        if ((pstcScrub->u32SectorErrCount >= pstcScrub->u32RewriteThreshold) && (NULL != pstcScrub->pu8Buf)) {
+            pstcScrub->u32RewriteAddr = u32Sector;
+        }
+        pstcScrub->u32SectorErrCount = 0UL;
+        if (pstcScrub->u32Addr >= pstcScrub->u32EndAddr) {
+            pstcScrub->u32Addr = pstcScrub->u32StartAddr;
+            pstcScrub->u32PassCount++;
+        }
+    }
+
+    return i32Ret;
+}
 /**
  * @}
  */
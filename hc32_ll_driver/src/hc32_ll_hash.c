@@ -8,6 +8,7 @@
    2024-09-13       CDT             First version
    2024-11-08       CDT             Fixed HASH_HMAC_Calculate function
    2025-01-20       CDT             Optimize HASH_DoCalc function
+   2026-10-18       CDT             Add Hash_DRBG based on SHA256
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -66,6 +67,28 @@
  * @}
  */
 
+/**
+ * @defgroup HASH_DRBG_Macros HASH DRBG Macros
+ * @{
+ */
+#define HASH_DRBG_DIGEST_SIZE           (32U)
+/* Hash_df prefix: counter(1 byte) || no_of_bits_to_return(4 bytes) */
+#define HASH_DRBG_DF_PREFIX_SIZE        (5U)
+/* Hash_df input of reseed: prefix || 0x01 || V || entropy || additional input */
+#define HASH_DRBG_RESEED_BUF_SIZE       (HASH_DRBG_DF_PREFIX_SIZE + 1U + HASH_DRBG_SEED_SIZE + \
+                                         (2U * HASH_DRBG_INPUT_SIZE_MAX))
+/* Hash_df input of instantiate: prefix || entropy || nonce || personalization string */
+#define HASH_DRBG_INIT_BUF_SIZE         (HASH_DRBG_DF_PREFIX_SIZE + (3U * HASH_DRBG_INPUT_SIZE_MAX))
+/* Largest Hash_df input */
+#define HASH_DRBG_BUF_SIZE              LL_MAX(HASH_DRBG_RESEED_BUF_SIZE, HASH_DRBG_INIT_BUF_SIZE)
+
+#define IS_HASH_DRBG_INPUT(p, s)        (((s) == 0U) || (((p) != NULL) && ((s) <= HASH_DRBG_INPUT_SIZE_MAX)))
+#define IS_HASH_DRBG_ENTROPY(p, s)      (((p) != NULL) && ((s) >= HASH_DRBG_ENTROPY_SIZE_MIN) && \
+                                         ((s) <= HASH_DRBG_INPUT_SIZE_MAX))
+/**
+ * @}
+ */
+
 /**
  * @defgroup HASH_Action HASH Action
  * @{
@@ -292,6 +315,94 @@ static void HASH_ReadMsgDigest(uint8_t *pu8MsgDigest)
     }
 }
 
+/**
+ * @brief  Hash_DRBG addition: pu8Dest = (pu8Dest + pu8Src) mod 2^seedlen, both are big endian.
+ * @param  [in,out] pu8Dest             Pointer to a HASH_DRBG_SEED_SIZE bytes number.
+ * @param  [in]  pu8Src                 Pointer to the number to be added.
+ * @param  [in]  u32SrcSize             Size(in byte) of pu8Src, not greater than HASH_DRBG_SEED_SIZE.
+ * @retval None
+ */
+static void HASH_DRBG_Add(uint8_t *pu8Dest, const uint8_t *pu8Src, uint32_t u32SrcSize)
+{
+    uint32_t i = HASH_DRBG_SEED_SIZE;
+    uint32_t j = u32SrcSize;
+    uint32_t u32Sum = 0UL;
+
+    while (i > 0U) {
+        i--;
+        u32Sum += pu8Dest[i];
+        if (j > 0U) {
+            j--;
+            u32Sum += pu8Src[j];
+        }
+        pu8Dest[i] = (uint8_t)u32Sum;
+        u32Sum >>= 8U;
+    }
+}
+
+/**
+ * @brief  Hash_DRBG derivation function Hash_df, returns HASH_DRBG_SEED_SIZE bytes.
+ * @param  [in,out] pu8Buf              Pointer to the input buffer. The first HASH_DRBG_DF_PREFIX_SIZE
+ *                                      bytes are reserved for the prefix, the input string follows.
+ * @param  [in]  u32InputSize           Size(in byte) of the input string, the prefix is not included.
+ * @param  [out] pu8Out                 Pointer to a HASH_DRBG_SEED_SIZE bytes buffer.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_TIMEOUT:          Works timeout.
+ */
+static int32_t HASH_DRBG_DF(uint8_t *pu8Buf, uint32_t u32InputSize, uint8_t *pu8Out)
+{
+    int32_t i32Ret;
+    uint8_t au8Digest[HASH_DRBG_DIGEST_SIZE * 2U];
+
+    /* no_of_bits_to_return = 440 */
+    pu8Buf[1U] = 0U;
+    pu8Buf[2U] = 0U;
+    pu8Buf[3U] = (uint8_t)((HASH_DRBG_SEED_SIZE * 8U) >> 8U);
+    pu8Buf[4U] = (uint8_t)(HASH_DRBG_SEED_SIZE * 8U);
+
+    pu8Buf[0U] = 1U;
+    i32Ret = HASH_Calculate(pu8Buf, HASH_DRBG_DF_PREFIX_SIZE + u32InputSize, au8Digest);
+    if (i32Ret == LL_OK) {
+        pu8Buf[0U] = 2U;
+        i32Ret = HASH_Calculate(pu8Buf, HASH_DRBG_DF_PREFIX_SIZE + u32InputSize, &au8Digest[HASH_DRBG_DIGEST_SIZE]);
+    }
+    if (i32Ret == LL_OK) {
+        HASH_MemCopy(pu8Out, au8Digest, HASH_DRBG_SEED_SIZE);
+    }
+    HASH_MemSet(au8Digest, 0U, sizeof(au8Digest));
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Hash_DRBG reseeding and instantiation common part: V = seed, C = Hash_df(0x00 || V).
+ * @param  [in]  pstcDrbg               Pointer to a @ref stc_hash_drbg_t structure.
+ * @param  [in,out] pu8Buf              Pointer to the Hash_df input buffer which contains the seed material.
+ * @param  [in]  u32InputSize           Size(in byte) of the seed material.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_TIMEOUT:          Works timeout.
+ */
+static int32_t HASH_DRBG_Update(stc_hash_drbg_t *pstcDrbg, uint8_t *pu8Buf, uint32_t u32InputSize)
+{
+    int32_t i32Ret;
+
+    i32Ret = HASH_DRBG_DF(pu8Buf, u32InputSize, pstcDrbg->au8V);
+    if (i32Ret == LL_OK) {
+        pu8Buf[HASH_DRBG_DF_PREFIX_SIZE] = 0x00U;
+        HASH_MemCopy(&pu8Buf[HASH_DRBG_DF_PREFIX_SIZE + 1U], pstcDrbg->au8V, HASH_DRBG_SEED_SIZE);
+        i32Ret = HASH_DRBG_DF(pu8Buf, 1U + HASH_DRBG_SEED_SIZE, pstcDrbg->au8C);
+    }
+    if (i32Ret == LL_OK) {
+        pstcDrbg->u32ReseedCounter = 1UL;
+    } else {
+        pstcDrbg->u32ReseedCounter = 0UL;
+    }
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
@@ -650,6 +761,192 @@ void HASH_GetMsgDigest(uint8_t *pu8MsgDigest)
     HASH_ReadMsgDigest(pu8MsgDigest);
 }
 
+/**
+ * @brief  Instantiates a Hash_DRBG(NIST SP800-90A, SHA256).
+ * @param  [out] pstcDrbg               Pointer to a @ref stc_hash_drbg_t structure.
+ * @param  [in]  pstcSeed               Pointer to a @ref stc_hash_drbg_seed_t structure which contains the seed material.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       Parameter error.
+ *           - LL_ERR_TIMEOUT:          Works timeout.
+ * @note The entropy input is normally read from TRNG, e.g. by TRNG_PoolRead(). The DRBG then
+ *       provides random numbers at HASH speed, see HASH_DRBG_Generate().
+ */
+int32_t HASH_DRBG_Init(stc_hash_drbg_t *pstcDrbg, const stc_hash_drbg_seed_t *pstcSeed)
+{
+    int32_t i32Ret;
+    uint32_t u32Size;
+    uint8_t au8Buf[HASH_DRBG_BUF_SIZE];
+
+    if ((pstcDrbg == NULL) || (pstcSeed == NULL) || \
+        (!IS_HASH_DRBG_ENTROPY(pstcSeed->pu8Entropy, pstcSeed->u32EntropySize)) || \
+        (!IS_HASH_DRBG_INPUT(pstcSeed->pu8Nonce, pstcSeed->u32NonceSize)) || \
+        (!IS_HASH_DRBG_INPUT(pstcSeed->pu8PersStr, pstcSeed->u32PersStrSize))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    /* seed_material = entropy_input || nonce || personalization_string */
+    u32Size = HASH_DRBG_DF_PREFIX_SIZE;
+    HASH_MemCopy(&au8Buf[u32Size], pstcSeed->pu8Entropy, pstcSeed->u32EntropySize);
+    u32Size += pstcSeed->u32EntropySize;
+    HASH_MemCopy(&au8Buf[u32Size], pstcSeed->pu8Nonce, pstcSeed->u32NonceSize);
+    u32Size += pstcSeed->u32NonceSize;
+    HASH_MemCopy(&au8Buf[u32Size], pstcSeed->pu8PersStr, pstcSeed->u32PersStrSize);
+    u32Size += pstcSeed->u32PersStrSize;
+
+    i32Ret = HASH_DRBG_Update(pstcDrbg, au8Buf, u32Size - HASH_DRBG_DF_PREFIX_SIZE);
+    HASH_MemSet(au8Buf, 0U, sizeof(au8Buf));
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Uninstantiates a Hash_DRBG and clears its working state.
+ * @param  [in]  pstcDrbg               Pointer to a @ref stc_hash_drbg_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcDrbg == NULL.
+ */
+int32_t HASH_DRBG_DeInit(stc_hash_drbg_t *pstcDrbg)
+{
+    if (pstcDrbg == NULL) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    HASH_MemSet(pstcDrbg->au8V, 0U, HASH_DRBG_SEED_SIZE);
+    HASH_MemSet(pstcDrbg->au8C, 0U, HASH_DRBG_SEED_SIZE);
+    pstcDrbg->u32ReseedCounter = 0UL;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Reseeds a Hash_DRBG with new entropy.
+ * @param  [in]  pstcDrbg               Pointer to a @ref stc_hash_drbg_t structure.
+ * @param  [in]  pu8Entropy             Pointer to the entropy input.
+ * @param  [in]  u32EntropySize         Size(in byte) of the entropy input.
+ *                                      This parameter must be between HASH_DRBG_ENTROPY_SIZE_MIN and HASH_DRBG_INPUT_SIZE_MAX
+ * @param  [in]  pu8AddInput            Pointer to the additional input, set it to NULL if not used.
+ * @param  [in]  u32AddInputSize        Size(in byte) of the additional input, not greater than HASH_DRBG_INPUT_SIZE_MAX.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       Parameter error.
+ *           - LL_ERR_UNINIT:           The DRBG is not instantiated.
+ *           - LL_ERR_TIMEOUT:          Works timeout.
+ */
+int32_t HASH_DRBG_Reseed(stc_hash_drbg_t *pstcDrbg, const uint8_t *pu8Entropy, uint32_t u32EntropySize,
+                         const uint8_t *pu8AddInput, uint32_t u32AddInputSize)
+{
+    int32_t i32Ret;
+    uint32_t u32Size;
+    uint8_t au8Buf[HASH_DRBG_BUF_SIZE];
+
+    if ((pstcDrbg == NULL) || (!IS_HASH_DRBG_ENTROPY(pu8Entropy, u32EntropySize)) || \
+        (!IS_HASH_DRBG_INPUT(pu8AddInput, u32AddInputSize))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (pstcDrbg->u32ReseedCounter == 0UL) {
+        return LL_ERR_UNINIT;
+    }
+
+    /* seed_material = 0x01 || V || entropy_input || additional_input */
+    u32Size = HASH_DRBG_DF_PREFIX_SIZE;
+    au8Buf[u32Size] = 0x01U;
+    u32Size++;
+    HASH_MemCopy(&au8Buf[u32Size], pstcDrbg->au8V, HASH_DRBG_SEED_SIZE);
+    u32Size += HASH_DRBG_SEED_SIZE;
+    HASH_MemCopy(&au8Buf[u32Size], pu8Entropy, u32EntropySize);
+    u32Size += u32EntropySize;
+    HASH_MemCopy(&au8Buf[u32Size], pu8AddInput, u32AddInputSize);
+    u32Size += u32AddInputSize;
+
+    i32Ret = HASH_DRBG_Update(pstcDrbg, au8Buf, u32Size - HASH_DRBG_DF_PREFIX_SIZE);
+    HASH_MemSet(au8Buf, 0U, sizeof(au8Buf));
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Generates random bytes by a Hash_DRBG.
+ * @param  [in]  pstcDrbg               Pointer to a @ref stc_hash_drbg_t structure.
+ * @param  [out] pu8Out                 Pointer to the buffer to store the random bytes.
+ * @param  [in]  u32Size                Number of random bytes, not greater than HASH_DRBG_REQUEST_SIZE_MAX.
+ * @param  [in]  pu8AddInput            Pointer to the additional input, set it to NULL if not used.
+ * @param  [in]  u32AddInputSize        Size(in byte) of the additional input, not greater than HASH_DRBG_INPUT_SIZE_MAX.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       Parameter error.
+ *           - LL_ERR_UNINIT:           The DRBG is not instantiated.
+ *           - LL_ERR_NOT_RDY:          Reseed is required, call HASH_DRBG_Reseed() and try again.
+ *           - LL_ERR_TIMEOUT:          Works timeout.
+ */
+int32_t HASH_DRBG_Generate(stc_hash_drbg_t *pstcDrbg, uint8_t *pu8Out, uint32_t u32Size,
+                           const uint8_t *pu8AddInput, uint32_t u32AddInputSize)
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Offset = 0UL;
+    uint32_t u32Len;
+    uint8_t au8Counter[4U];
+    uint8_t au8Digest[HASH_DRBG_DIGEST_SIZE];
+    uint8_t au8Buf[1U + HASH_DRBG_SEED_SIZE + HASH_DRBG_INPUT_SIZE_MAX];
+
+    if ((pstcDrbg == NULL) || (pu8Out == NULL) || (u32Size == 0UL) || \
+        (u32Size > HASH_DRBG_REQUEST_SIZE_MAX) || (!IS_HASH_DRBG_INPUT(pu8AddInput, u32AddInputSize))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (pstcDrbg->u32ReseedCounter == 0UL) {
+        return LL_ERR_UNINIT;
+    }
+    if (pstcDrbg->u32ReseedCounter > HASH_DRBG_RESEED_INTERVAL) {
+        return LL_ERR_NOT_RDY;
+    }
+
+    /* w = Hash(0x02 || V || additional_input), V = (V + w) mod 2^seedlen */
+    if (u32AddInputSize > 0UL) {
+        au8Buf[0U] = 0x02U;
+        HASH_MemCopy(&au8Buf[1U], pstcDrbg->au8V, HASH_DRBG_SEED_SIZE);
+        HASH_MemCopy(&au8Buf[1U + HASH_DRBG_SEED_SIZE], pu8AddInput, u32AddInputSize);
+        i32Ret = HASH_Calculate(au8Buf, 1U + HASH_DRBG_SEED_SIZE + u32AddInputSize, au8Digest);
+        if (i32Ret == LL_OK) {
+            HASH_DRBG_Add(pstcDrbg->au8V, au8Digest, HASH_DRBG_DIGEST_SIZE);
+        }
+    }
+
+    /* Hashgen: data = V, output Hash(data) and data = data + 1 till requested bytes are generated */
+    HASH_MemCopy(au8Buf, pstcDrbg->au8V, HASH_DRBG_SEED_SIZE);
+    while ((i32Ret == LL_OK) && (u32Offset < u32Size)) {
+        i32Ret = HASH_Calculate(au8Buf, HASH_DRBG_SEED_SIZE, au8Digest);
+        if (i32Ret == LL_OK) {
+            u32Len = LL_MIN(HASH_DRBG_DIGEST_SIZE, u32Size - u32Offset);
+            HASH_MemCopy(&pu8Out[u32Offset], au8Digest, u32Len);
+            u32Offset += u32Len;
+            au8Counter[0U] = 1U;
+            HASH_DRBG_Add(au8Buf, au8Counter, 1U);
+        }
+    }
+
+    /* H = Hash(0x03 || V), V = (V + H + C + reseed_counter) mod 2^seedlen */
+    if (i32Ret == LL_OK) {
+        au8Buf[0U] = 0x03U;
+        HASH_MemCopy(&au8Buf[1U], pstcDrbg->au8V, HASH_DRBG_SEED_SIZE);
+        i32Ret = HASH_Calculate(au8Buf, 1U + HASH_DRBG_SEED_SIZE, au8Digest);
+    }
+    if (i32Ret == LL_OK) {
+        HASH_DRBG_Add(pstcDrbg->au8V, au8Digest, HASH_DRBG_DIGEST_SIZE);
+        HASH_DRBG_Add(pstcDrbg->au8V, pstcDrbg->au8C, HASH_DRBG_SEED_SIZE);
+        au8Counter[0U] = (uint8_t)(pstcDrbg->u32ReseedCounter >> 24U);
+        au8Counter[1U] = (uint8_t)(pstcDrbg->u32ReseedCounter >> 16U);
+        au8Counter[2U] = (uint8_t)(pstcDrbg->u32ReseedCounter >> 8U);
+        au8Counter[3U] = (uint8_t)(pstcDrbg->u32ReseedCounter);
+        HASH_DRBG_Add(pstcDrbg->au8V, au8Counter, 4U);
+        pstcDrbg->u32ReseedCounter++;
+    }
+    HASH_MemSet(au8Buf, 0U, sizeof(au8Buf));
+    HASH_MemSet(au8Digest, 0U, sizeof(au8Digest));
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
@@ -6,6 +6,8 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add message RAM planner and zero-copy Rx access
+   2026-10-18       CDT             Add batched Tx FIFO/queue submission and Tx event retrieval
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -137,6 +139,8 @@
 #define MCAN_STD_FILTER_ES              (4U)
 #define MCAN_EXT_FILTER_ES              (8U)
 #define MCAN_TX_EVT_ES                  (8U)
+#define MCAN_ELMT_HEADER_SIZE           (8U)
+#define MCAN_DATA_BYTES_MAX             (64U)
 #define MCAN_RX_FIFO0_ES(u)             ((uint32_t)m_au8ElmtSize[MCAN_RX_FIFO0_DS(u)])
 #define MCAN_RX_FIFO1_ES(u)             ((uint32_t)m_au8ElmtSize[MCAN_RX_FIFO1_DS(u)])
 #define MCAN_RX_BUF_ES(u)               ((uint32_t)m_au8ElmtSize[MCAN_RX_BUF_DS(u)])
@@ -655,6 +659,64 @@ static void MCAN_CopyTxMsgToRam(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t *pTxMs
     }
 }
 
+/**
+ * @brief  Copy a Tx event from the message RAM.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  u32TxEventAddr         Address of the Tx event element.
+ * @param  [out] pTxEvent               Pointer to a @ref stc_mcan_tx_event_t structure which is used to save
+ *                                      the Tx event.
+ * @retval None
+ */
+static void MCAN_CopyTxEventFromRam(const CM_MCAN_TypeDef *MCANx, uint32_t u32TxEventAddr,
+                                    stc_mcan_tx_event_t *pTxEvent)
+{
+    /* Retrieve ID type */
+    pTxEvent->IDE = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_XTD_MASK) >> MCAN_FRAME_XTD_POS;
+
+    /* Retrieve ID */
+    if (pTxEvent->IDE == MCAN_STD_ID) {
+        /* Standard ID element */
+        pTxEvent->ID = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_STDID_MASK) >> MCAN_FRAME_STDID_POS;
+    } else {
+        /* Extended ID element */
+        pTxEvent->ID = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_EXTID_MASK);
+    }
+
+    /* Retrieve Tx frame type */
+    pTxEvent->RTR = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_RTR_MASK) >> MCAN_FRAME_RTR_POS;
+
+    /* Retrieve ESI */
+    pTxEvent->ESI = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_ESI_MASK) >> MCAN_FRAME_ESI_POS;
+
+    /* Increment Tx event memory pointer to second word of Tx event FIFO element */
+    u32TxEventAddr += 4UL;
+
+    /* Retrieve DLC */
+    pTxEvent->DLC = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_DLC_MASK) >> MCAN_FRAME_DLC_POS;
+
+    /* Retrieve BRS */
+    pTxEvent->BRS = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_BRS_MASK) >> MCAN_FRAME_BRS_POS;
+
+    /* Retrieve FDF */
+    pTxEvent->FDF = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_FDF_MASK) >> MCAN_FRAME_FDF_POS;
+
+    /* Retrieve event type */
+    pTxEvent->u32EventType = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_ET_MASK) >> MCAN_FRAME_ET_POS;
+
+    /* Retrieve message marker */
+    pTxEvent->u32MsgMarker = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_MM_L_MASK) >> MCAN_FRAME_MM_L_POS;
+    /* If 16-bit(wide) message marker used */
+    if (READ_REG32_BIT(MCANx->CCCR, MCAN_CCCR_WMM) != 0U) {
+        pTxEvent->u32MsgMarker |= READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_MM_H_MASK);
+    } else {
+        /* Retrieve Tx timestamp. It is invalid if 16-bit(wide) message marker used. */
+        pTxEvent->u32TxTimestamp = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_TS_MASK);
+    }
+}
+
 /**
  * @brief  Get the number of the Rx buffer that has an allocated area into the message RAM.
  * @param  [in]  MCANx                  Pointer to MCAN instance register base.
@@ -674,6 +736,100 @@ static uint32_t MCAN_GetRxBufferNum(const CM_MCAN_TypeDef *MCANx)
     return (u32Temp / MCAN_RX_BUF_ES(MCANx));
 }
 
+/**
+ * @brief  Get the smallest data field size that holds a payload.
+ * @param  [in]  u32Bytes               Payload size in bytes, 0 ~ 64.
+ * @retval An uint32_t type value of @ref MCAN_Data_Field_Size
+ */
+static uint32_t MCAN_GetDataFieldSize(uint32_t u32Bytes)
+{
+    uint32_t u32Size = MCAN_DATA_SIZE_MIN;
+
+    while ((u32Size < MCAN_DATA_SIZE_MAX) && ((MCAN_GET_ES(u32Size) - MCAN_ELMT_HEADER_SIZE) < u32Bytes)) {
+        u32Size++;
+    }
+    return u32Size;
+}
+
+/**
+ * @brief  Get the message RAM size of a message RAM configuration.
+ * @param  [in]  pstcMsgRam             Pointer to a @ref stc_mcan_msg_ram_config_t structure.
+ * @retval An uint32_t type value of the size in bytes.
+ */
+static uint32_t MCAN_GetMsgRamSize(const stc_mcan_msg_ram_config_t *pstcMsgRam)
+{
+    return (pstcMsgRam->u32StdFilterNum * MCAN_STD_FILTER_ES) + \
+           (pstcMsgRam->u32ExtFilterNum * MCAN_EXT_FILTER_ES) + \
+           (pstcMsgRam->u32RxFifo0Num * MCAN_GET_ES(pstcMsgRam->u32RxFifo0DataSize)) + \
+           (pstcMsgRam->u32RxFifo1Num * MCAN_GET_ES(pstcMsgRam->u32RxFifo1DataSize)) + \
+           (pstcMsgRam->u32RxBufferNum * MCAN_GET_ES(pstcMsgRam->u32RxBufferDataSize)) + \
+           (pstcMsgRam->u32TxEventNum * MCAN_TX_EVT_ES) + \
+           ((pstcMsgRam->u32TxBufferNum + pstcMsgRam->u32TxFifoQueueNum) * MCAN_GET_ES(pstcMsgRam->u32TxDataSize));
+}
+
+/**
+ * @brief  Get the address of an Rx element in the message RAM.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  u32RxLocation          Location of the received message to be read.
+ *                                      This parameter can be a value of @ref MCAN_Rx_Location
+ * @param  [out] pu32Addr               Pointer to the element address.
+ * @param  [out] pu32GetIndex           Pointer to the get index of the Rx FIFO, not changed for a dedicated Rx buffer.
+ * @param  [out] pu32DataFieldSize      Pointer to the configured data field size in bytes.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       The selected Rx FIFO has no allocated area into the message RAM;
+ *                                      The selected Rx buffer is out of range.
+ *           - LL_ERR_BUF_EMPTY:        The selected Rx FIFO is empty.
+ */
+static int32_t MCAN_GetRxElmtAddr(const CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, uint32_t *pu32Addr,
+                                  uint32_t *pu32GetIndex, uint32_t *pu32DataFieldSize)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (u32RxLocation == MCAN_RX_FIFO0) {
+        /* Check that the Rx FIFO0 has an allocated area into the message RAM */
+        if (READ_REG32_BIT(MCANx->RXF0C, MCAN_RXF0C_F0S) == 0U) {
+            i32Ret = LL_ERR_INVD_PARAM;
+        } else if (READ_REG32_BIT(MCANx->RXF0S, MCAN_RXF0S_F0FL) == 0U) {
+            /* The Rx FIFO0 is empty */
+            i32Ret = LL_ERR_BUF_EMPTY;
+        } else {
+            /* Calculate Rx FIFO0 element index and address */
+            *pu32GetIndex = (READ_REG32_BIT(MCANx->RXF0S, MCAN_RXF0S_F0GI) >> MCAN_RXF0S_F0GI_POS);
+            *pu32Addr = MCAN_RX_FIFO0_SA(MCANx) + (*pu32GetIndex * MCAN_RX_FIFO0_ES(MCANx));
+            *pu32DataFieldSize = MCAN_RX_FIFO0_REAL_DS(MCANx);
+        }
+    } else if (u32RxLocation == MCAN_RX_FIFO1) {
+        /* Check that the Rx FIFO1 has an allocated area into the message RAM */
+        if (READ_REG32_BIT(MCANx->RXF1C, MCAN_RXF1C_F1S) == 0U) {
+            i32Ret = LL_ERR_INVD_PARAM;
+        } else if (READ_REG32_BIT(MCANx->RXF1S, MCAN_RXF1S_F1FL) == 0U) {
+            /* The Rx FIFO1 is empty */
+            i32Ret = LL_ERR_BUF_EMPTY;
+        } else {
+            /* Calculate Rx FIFO1 element index and address */
+            *pu32GetIndex = (READ_REG32_BIT(MCANx->RXF1S, MCAN_RXF1S_F1GI) >> MCAN_RXF1S_F1GI_POS);
+            *pu32Addr = MCAN_RX_FIFO1_SA(MCANx) + (*pu32GetIndex * MCAN_RX_FIFO1_ES(MCANx));
+            *pu32DataFieldSize = MCAN_RX_FIFO1_REAL_DS(MCANx);
+        }
+    } else {
+        /* Rx element is assigned to a dedicated Rx buffer.
+           Check that the selected buffer has an allocated area into the message RAM. */
+        if (u32RxLocation >= MCAN_GetRxBufferNum(MCANx)) {
+            i32Ret = LL_ERR_INVD_PARAM;
+        } else {
+            /* Calculate Rx buffer address */
+            *pu32Addr = MCAN_RX_BUF_SA(MCANx) + (u32RxLocation * MCAN_RX_BUF_ES(MCANx));
+            *pu32DataFieldSize = MCAN_RX_BUF_REAL_DS(MCANx);
+        }
+    }
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
@@ -1155,6 +1311,109 @@ int32_t MCAN_GetMsgRamAddr(const CM_MCAN_TypeDef *MCANx, stc_mcan_msg_ram_addr_t
     return i32Ret;
 }
 
+/**
+ * @brief  Plan the message RAM of an MCAN from a demand description.
+ * @param  [in]  pstcDemand             Pointer to a @ref stc_mcan_msg_ram_demand_t structure.
+ * @param  [out] pstcMsgRam             Pointer to a @ref stc_mcan_msg_ram_config_t structure, it can be used as
+ *                                      stcMsgRam of @ref stc_mcan_init_t.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or a member of pstcDemand is out of range.
+ *           - LL_ERR_BUF_FULL:         The minimum demand does not fit in the RAM size.
+ * @note   1) The data field size of each section is the smallest one that holds its largest payload.
+ *         2) Rx FIFO0, Rx FIFO1 and Tx FIFO/queue with non-zero minimum numbers are extended by one element
+ *            in turn until the RAM size is used up. The Tx event FIFO, if demanded, grows with the Tx elements
+ *            so that no Tx event is lost.
+ *         3) u32AllocatedSize is the planned size, the next MCAN can start at u32AddrOffset + u32AllocatedSize.
+ */
+int32_t MCAN_MsgRamPlan(const stc_mcan_msg_ram_demand_t *pstcDemand, stc_mcan_msg_ram_config_t *pstcMsgRam)
+{
+    uint32_t i;
+    uint32_t u32Budget;
+    uint32_t u32Grown;
+    uint32_t *pu32Num;
+    uint32_t u32TxElmtNum;
+    uint32_t u32TxEvtInc;
+    uint32_t au32Max[3U];
+    uint32_t *apu32Num[3U];
+
+    if ((pstcDemand == NULL) || (pstcMsgRam == NULL)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if ((!IS_MCAN_MSG_RAM_OFFSET_ADDR(pstcDemand->u32AddrOffset)) ||
+        (!IS_MCAN_STD_FILTER_NUM(pstcDemand->u32StdFilterNum)) ||
+        (!IS_MCAN_EXT_FILTER_NUM(pstcDemand->u32ExtFilterNum)) ||
+        (!IS_MCAN_RX_FIFO0_NUM(pstcDemand->u32RxFifo0Num)) ||
+        (!IS_MCAN_RX_FIFO1_NUM(pstcDemand->u32RxFifo1Num)) ||
+        (!IS_MCAN_RX_BUF_NUM(pstcDemand->u32RxBufferNum)) ||
+        (!IS_MCAN_TX_EVT_NUM(pstcDemand->u32TxEventNum)) ||
+        (!IS_MCAN_TX_ELMT_NUM(pstcDemand->u32TxBufferNum + pstcDemand->u32TxFifoQueueNum)) ||
+        (!IS_MCAN_TX_FIFO_QUEUE_MD(pstcDemand->u32TxFifoQueueMode)) ||
+        (pstcDemand->u32RxFifo0MaxData > MCAN_DATA_BYTES_MAX) ||
+        (pstcDemand->u32RxFifo1MaxData > MCAN_DATA_BYTES_MAX) ||
+        (pstcDemand->u32RxBufferMaxData > MCAN_DATA_BYTES_MAX) ||
+        (pstcDemand->u32TxMaxData > MCAN_DATA_BYTES_MAX)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcMsgRam->u32AddrOffset       = pstcDemand->u32AddrOffset;
+    pstcMsgRam->u32StdFilterNum     = pstcDemand->u32StdFilterNum;
+    pstcMsgRam->u32ExtFilterNum     = pstcDemand->u32ExtFilterNum;
+    pstcMsgRam->u32RxFifo0Num       = pstcDemand->u32RxFifo0Num;
+    pstcMsgRam->u32RxFifo0DataSize  = MCAN_GetDataFieldSize(pstcDemand->u32RxFifo0MaxData);
+    pstcMsgRam->u32RxFifo1Num       = pstcDemand->u32RxFifo1Num;
+    pstcMsgRam->u32RxFifo1DataSize  = MCAN_GetDataFieldSize(pstcDemand->u32RxFifo1MaxData);
+    pstcMsgRam->u32RxBufferNum      = pstcDemand->u32RxBufferNum;
+    pstcMsgRam->u32RxBufferDataSize = MCAN_GetDataFieldSize(pstcDemand->u32RxBufferMaxData);
+    pstcMsgRam->u32TxEventNum       = pstcDemand->u32TxEventNum;
+    pstcMsgRam->u32TxBufferNum      = pstcDemand->u32TxBufferNum;
+    pstcMsgRam->u32TxFifoQueueNum   = pstcDemand->u32TxFifoQueueNum;
+    pstcMsgRam->u32TxFifoQueueMode  = pstcDemand->u32TxFifoQueueMode;
+    pstcMsgRam->u32TxDataSize       = MCAN_GetDataFieldSize(pstcDemand->u32TxMaxData);
+
+    u32Budget = LL_MIN(pstcDemand->u32RamSize, MCAN_MSG_RAM_SIZE - pstcDemand->u32AddrOffset);
+    pstcMsgRam->u32AllocatedSize = MCAN_GetMsgRamSize(pstcMsgRam);
+    if (pstcMsgRam->u32AllocatedSize > u32Budget) {
+        return LL_ERR_BUF_FULL;
+    }
+
+    /* Extend the demanded FIFOs in turn */
+    apu32Num[0U] = &pstcMsgRam->u32RxFifo0Num;
+    apu32Num[1U] = &pstcMsgRam->u32RxFifo1Num;
+    apu32Num[2U] = &pstcMsgRam->u32TxFifoQueueNum;
+    au32Max[0U]  = (pstcDemand->u32RxFifo0Num != 0U) ? MCAN_RX_FIFO0_NUM_MAX : 0U;
+    au32Max[1U]  = (pstcDemand->u32RxFifo1Num != 0U) ? MCAN_RX_FIFO1_NUM_MAX : 0U;
+    au32Max[2U]  = (pstcDemand->u32TxFifoQueueNum != 0U) ? (MCAN_TX_ELMT_NUM_MAX - pstcDemand->u32TxBufferNum) : 0U;
+    do {
+        u32Grown = 0U;
+        for (i = 0U; i < 3U; i++) {
+            pu32Num = apu32Num[i];
+            if (*pu32Num >= au32Max[i]) {
+                continue;
+            }
+            (*pu32Num)++;
+            u32TxEvtInc = 0U;
+            if ((i == 2U) && (pstcDemand->u32TxEventNum != 0U)) {
+                u32TxElmtNum = pstcMsgRam->u32TxBufferNum + pstcMsgRam->u32TxFifoQueueNum;
+                if (pstcMsgRam->u32TxEventNum < LL_MIN(u32TxElmtNum, MCAN_TX_EVT_NUM_MAX)) {
+                    pstcMsgRam->u32TxEventNum++;
+                    u32TxEvtInc = 1U;
+                }
+            }
+            if (MCAN_GetMsgRamSize(pstcMsgRam) <= u32Budget) {
+                u32Grown = 1U;
+            } else {
+                (*pu32Num)--;
+                pstcMsgRam->u32TxEventNum -= u32TxEvtInc;
+                au32Max[i] = *pu32Num;
+            }
+        }
+    } while (u32Grown != 0U);
+    pstcMsgRam->u32AllocatedSize = MCAN_GetMsgRamSize(pstcMsgRam);
+
+    return LL_OK;
+}
+
 /**
  * @brief Configure a reception filter element in the message RAM according to the specified parameters
  *        in the stc_mcan_filter_t structure.
@@ -1767,6 +2026,107 @@ int32_t MCAN_AddMsgToTxFifoQueue(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t *pTxM
     return i32Ret;
 }
 
+/**
+ * @brief Add messages to the Tx FIFO/Queue and activate their transmission requests with one TXBAR write.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  astcTxMsg              Pointer to a @ref stc_mcan_tx_msg_t structure type array of the messages
+ *                                      to be transmitted, in transmission order.
+ * @param  [in]  u32MsgNum              Number of messages.
+ * @param  [out] pu32AddedNum           Pointer to the number of messages added, it can be NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   All the messages are added.
+ *           - LL_ERR_INVD_PARAM:       astcTxMsg == NULL or u32MsgNum == 0.
+ *                                      Tx FIFO/queue has no allocated area into the message RAM.
+ *           - LL_ERR_BUF_FULL:         Tx FIFO/queue is full, only the first *pu32AddedNum messages are added.
+ */
+int32_t MCAN_AddMsgsToTxFifoQueue(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_msg_t astcTxMsg[],
+                                  uint32_t u32MsgNum, uint32_t *pu32AddedNum)
+{
+    uint32_t i;
+    uint32_t u32FqStart;
+    uint32_t u32FqNum;
+    uint32_t u32FreeNum;
+    uint32_t u32FreeMask = 0UL;
+    uint32_t u32QueueMode;
+    uint32_t u32TxPutIndex;
+    uint32_t u32Request = 0UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_MCAN_UNIT(MCANx));
+
+    if (pu32AddedNum != NULL) {
+        *pu32AddedNum = 0U;
+    }
+    u32FqNum = MCAN_GET_TX_FQ_NUM(MCANx);
+    if ((astcTxMsg == NULL) || (u32MsgNum == 0U) || (u32FqNum == 0U)) {
+        return i32Ret;
+    }
+
+    u32FqStart    = MCAN_GET_TX_BUF_NUM(MCANx);
+    u32TxPutIndex = READ_REG32_BIT(MCANx->TXFQS, MCAN_TXFQS_TFQPI) >> MCAN_TXFQS_TFQPI_POS;
+    u32QueueMode  = READ_REG32_BIT(MCANx->TXBC, MCAN_TXBC_TFQM);
+    if (u32QueueMode == MCAN_TX_FIFO_MD) {
+        /* Free FIFO elements follow the put index */
+        u32FreeNum = READ_REG32_BIT(MCANx->TXFQS, MCAN_TXFQS_TFFL) >> MCAN_TXFQS_TFFL_POS;
+    } else {
+        /* Free queue elements are those without a pending request */
+        u32FreeMask = ((u32FqNum < 32U) ? ((1UL << u32FqNum) - 1UL) : 0xFFFFFFFFUL) << u32FqStart;
+        u32FreeMask &= ~READ_REG32(MCANx->TXBRP);
+        u32FreeNum = u32FqNum;
+    }
+    if (READ_REG32_BIT(MCANx->TXFQS, MCAN_TXFQS_TFQF) != 0U) {
+        u32FreeNum = 0U;
+    }
+
+    for (i = 0U; (i < u32MsgNum) && (i < u32FreeNum); i++) {
+        DDL_ASSERT(IS_MCAN_ID_TYPE(astcTxMsg[i].IDE));
+        if (astcTxMsg[i].IDE == MCAN_STD_ID) {
+            DDL_ASSERT(IS_MCAN_STD_ID_VAL(astcTxMsg[i].ID));
+        } else {
+            DDL_ASSERT(IS_MCAN_EXT_ID_VAL(astcTxMsg[i].ID));
+        }
+        DDL_ASSERT(IS_MCAN_FRAME_RTR(astcTxMsg[i].RTR));
+        DDL_ASSERT(IS_MCAN_FRAME_DLC(astcTxMsg[i].DLC));
+        DDL_ASSERT(IS_MCAN_FRAME_ESI(astcTxMsg[i].ESI));
+        DDL_ASSERT(IS_MCAN_FRAME_BRS(astcTxMsg[i].BRS));
+        DDL_ASSERT(IS_MCAN_FRAME_FDF(astcTxMsg[i].FDF));
+        DDL_ASSERT(IS_MCAN_FRAME_EFC(astcTxMsg[i].u32StoreTxEvent));
+        DDL_ASSERT(IS_MCAN_FRAME_MSG_MARKER(READ_REG32_BIT(MCANx->CCCR, MCAN_CCCR_WMM), astcTxMsg[i].u32MsgMarker));
+
+        if (u32QueueMode != MCAN_TX_FIFO_MD) {
+            if (u32FreeMask == 0UL) {
+                break;
+            }
+            /* Queue mode: lowest free element */
+            u32TxPutIndex = GET_BIT_POS(u32FreeMask);
+            u32FreeMask &= u32FreeMask - 1UL;
+        }
+        MCAN_CopyTxMsgToRam(MCANx, &astcTxMsg[i], u32TxPutIndex);
+        astcTxMsg[i].u32LastTxFifoQueueRequest = 1UL << u32TxPutIndex;
+        u32Request |= astcTxMsg[i].u32LastTxFifoQueueRequest;
+
+        /* FIFO mode: next element, wrapping within the FIFO area */
+        u32TxPutIndex++;
+        if (u32TxPutIndex >= (u32FqStart + u32FqNum)) {
+            u32TxPutIndex = u32FqStart;
+        }
+    }
+
+    if (u32Request != 0UL) {
+        /* Activate all the transmission requests at once */
+        WRITE_REG32(MCANx->TXBAR, u32Request);
+    }
+    if (pu32AddedNum != NULL) {
+        *pu32AddedNum = i;
+    }
+    i32Ret = (i == u32MsgNum) ? LL_OK : LL_ERR_BUF_FULL;
+
+    return i32Ret;
+}
+
 /**
  * @brief Add a message to a dedicated Tx buffer.
  * @param  [in]  MCANx                  Pointer to MCAN instance register base.
@@ -1915,70 +2275,7 @@ int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_r
     DDL_ASSERT(IS_MCAN_UNIT(MCANx));
 
     if (pRxMsg != NULL) {
-        i32Ret = LL_OK;
-        if (u32RxLocation == MCAN_RX_FIFO0) {
-            /* Check that the Rx FIFO0 has an allocated area into the message RAM */
-            if (READ_REG32_BIT(MCANx->RXF0C, MCAN_RXF0C_F0S) == 0U) {
-                i32Ret = LL_ERR_INVD_PARAM;
-            }
-
-            if (i32Ret == LL_OK) {
-                /* Check that the Rx FIFO0 is not empty */
-                if (READ_REG32_BIT(MCANx->RXF0S, MCAN_RXF0S_F0FL) == 0U) {
-                    i32Ret = LL_ERR_BUF_EMPTY;
-                }
-            }
-
-            if (i32Ret == LL_OK) {
-                /* Calculate Rx FIFO0 element index*/
-                u32RxGetIndex = (READ_REG32_BIT(MCANx->RXF0S, MCAN_RXF0S_F0GI) >> MCAN_RXF0S_F0GI_POS);
-
-                /* Calculate Rx FIFO0 element address */
-                u32RxRamAddr  = MCAN_RX_FIFO0_SA(MCANx);
-                u32RxRamAddr += (u32RxGetIndex * MCAN_RX_FIFO0_ES(MCANx));
-
-                /* Get the configured data filed size of Rx FIFO0 */
-                u32DataFiledSize = MCAN_RX_FIFO0_REAL_DS(MCANx);
-            }
-        } else if (u32RxLocation == MCAN_RX_FIFO1) {
-            /* Check that the Rx FIFO1 has an allocated area into the message RAM */
-            if (READ_REG32_BIT(MCANx->RXF1C, MCAN_RXF1C_F1S) == 0U) {
-                i32Ret = LL_ERR_INVD_PARAM;
-            }
-
-            if (i32Ret == LL_OK) {
-                /* Check that the Rx FIFO1 is not empty */
-                if (READ_REG32_BIT(MCANx->RXF1S, MCAN_RXF1S_F1FL) == 0U) {
-                    i32Ret = LL_ERR_BUF_EMPTY;
-                }
-            }
-
-            if (i32Ret == LL_OK) {
-                /* Calculate Rx FIFO1 element index */
-                u32RxGetIndex = (READ_REG32_BIT(MCANx->RXF1S, MCAN_RXF1S_F1GI) >> MCAN_RXF1S_F1GI_POS);
-
-                /* Calculate Rx FIFO1 element address */
-                u32RxRamAddr  = MCAN_RX_FIFO1_SA(MCANx);
-                u32RxRamAddr += (u32RxGetIndex * MCAN_RX_FIFO1_ES(MCANx));
-
-                /* Get the configured data filed size of Rx FIFO1 */
-                u32DataFiledSize = MCAN_RX_FIFO1_REAL_DS(MCANx);
-            }
-        } else {
-            /* Rx element is assigned to a dedicated Rx buffer.
-               Check that the selected buffer has an allocated area into the message RAM. */
-            if (u32RxLocation >= MCAN_GetRxBufferNum(MCANx)) {
-                i32Ret = LL_ERR_INVD_PARAM;
-            } else {
-                /* Calculate Rx buffer address */
-                u32RxRamAddr  = MCAN_RX_BUF_SA(MCANx);
-                u32RxRamAddr += (u32RxLocation * MCAN_RX_BUF_ES(MCANx));
-
-                /* Get the configured data filed size of Rx buffer */
-                u32DataFiledSize = MCAN_RX_BUF_REAL_DS(MCANx);
-            }
-        }
-
+        i32Ret = MCAN_GetRxElmtAddr(MCANx, u32RxLocation, &u32RxRamAddr, &u32RxGetIndex, &u32DataFiledSize);
         if (i32Ret == LL_OK) {
             /* Retrieve ID type */
             pRxMsg->IDE = READ_REG32_BIT(RW_MEM32(u32RxRamAddr), MCAN_FRAME_XTD_MASK) >> MCAN_FRAME_XTD_POS;
@@ -2045,31 +2342,101 @@ int32_t MCAN_GetRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, stc_mcan_r
                 }
             }
 
-            if (u32RxLocation == MCAN_RX_FIFO0) {
-                /* Rx element is assigned to the Rx FIFO0.
-                   Acknowledge the Rx FIFO0 that the oldest element
-                   is read so that it increments the get index. */
-                WRITE_REG32(MCANx->RXF0A, u32RxGetIndex);
-            } else if (u32RxLocation == MCAN_RX_FIFO1) {
-                /* Rx element is assigned to the Rx FIFO1.
-                   Acknowledge the Rx FIFO1 that the oldest element
-                   is read so that it increments the get index. */
-                WRITE_REG32(MCANx->RXF1A, u32RxGetIndex);
+            MCAN_AckRxMsg(MCANx, u32RxLocation, u32RxGetIndex);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the address of a received frame in the message RAM without copying it.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  u32RxLocation          Location of the received message to be read.
+ *                                      This parameter can be a value of @ref MCAN_Rx_Location
+ * @param  [out] ppstcElmt              Pointer to the pointer of the Rx element, decode it with @ref MCAN_Rx_Element_Access
+ * @param  [out] pu32GetIndex           Pointer to the get index of the Rx FIFO, pass it to MCAN_AckRxMsg().
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       ppstcElmt == NULL or pu32GetIndex == NULL;
+ *                                      The selected Rx FIFO has no allocated area into the message RAM;
+ *                                      The selected Rx buffer is out of range.
+ *           - LL_ERR_BUF_EMPTY:        The selected Rx FIFO or Rx buffer is empty.
+ * @note   1) The element stays valid until it is released by MCAN_AckRxMsg(). Release Rx FIFO elements in order.
+ *         2) Only the configured data field size of the payload is stored, classical CAN frames have 8 bytes at most.
+ */
+int32_t MCAN_PeekRxMsg(const CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation,
+                       const stc_mcan_rx_elmt_t **ppstcElmt, uint32_t *pu32GetIndex)
+{
+    uint32_t u32RxRamAddr = 0U;
+    uint32_t u32DataFiledSize;
+    uint32_t u32NewData;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_MCAN_UNIT(MCANx));
+
+    if ((ppstcElmt != NULL) && (pu32GetIndex != NULL)) {
+        *pu32GetIndex = 0U;
+        i32Ret = MCAN_GetRxElmtAddr(MCANx, u32RxLocation, &u32RxRamAddr, pu32GetIndex, &u32DataFiledSize);
+        if ((i32Ret == LL_OK) && (u32RxLocation <= MCAN_RX_BUF_MAX)) {
+            /* Check the new data flag of the dedicated Rx buffer */
+            if (u32RxLocation < MCAN_RX_BUF32) {
+                u32NewData = READ_REG32_BIT(MCANx->NDAT1, 1UL << u32RxLocation);
             } else {
-                /* Rx element is assigned to a dedicated Rx buffer.
-                   Clear the new data flag of the current Rx buffer. */
-                if (u32RxLocation < MCAN_RX_BUF32) {
-                    WRITE_REG32(MCANx->NDAT1, (1UL << u32RxLocation));
-                } else {
-                    WRITE_REG32(MCANx->NDAT2, (1UL << (u32RxLocation & 0x1FUL)));
-                }
+                u32NewData = READ_REG32_BIT(MCANx->NDAT2, 1UL << (u32RxLocation & 0x1FUL));
             }
+            if (u32NewData == 0U) {
+                i32Ret = LL_ERR_BUF_EMPTY;
+            }
+        }
+        if (i32Ret == LL_OK) {
+            *ppstcElmt = (const stc_mcan_rx_elmt_t *)u32RxRamAddr;
         }
     }
 
     return i32Ret;
 }
 
+/**
+ * @brief  Release a received frame in the message RAM.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [in]  u32RxLocation          Location of the received message.
+ *                                      This parameter can be a value of @ref MCAN_Rx_Location
+ * @param  [in]  u32GetIndex            Get index returned by MCAN_PeekRxMsg(), not used for a dedicated Rx buffer.
+ * @retval None
+ */
+void MCAN_AckRxMsg(CM_MCAN_TypeDef *MCANx, uint32_t u32RxLocation, uint32_t u32GetIndex)
+{
+    DDL_ASSERT(IS_MCAN_UNIT(MCANx));
+
+    if (u32RxLocation == MCAN_RX_FIFO0) {
+        /* Rx element is assigned to the Rx FIFO0.
+           Acknowledge the Rx FIFO0 that the oldest element
+           is read so that it increments the get index. */
+        WRITE_REG32(MCANx->RXF0A, u32GetIndex);
+    } else if (u32RxLocation == MCAN_RX_FIFO1) {
+        /* Rx element is assigned to the Rx FIFO1.
+           Acknowledge the Rx FIFO1 that the oldest element
+           is read so that it increments the get index. */
+        WRITE_REG32(MCANx->RXF1A, u32GetIndex);
+    } else {
+        DDL_ASSERT(u32RxLocation <= MCAN_RX_BUF_MAX);
+        /* Rx element is assigned to a dedicated Rx buffer.
+           Clear the new data flag of the current Rx buffer. */
+        if (u32RxLocation < MCAN_RX_BUF32) {
+            WRITE_REG32(MCANx->NDAT1, (1UL << u32RxLocation));
+        } else {
+            WRITE_REG32(MCANx->NDAT2, (1UL << (u32RxLocation & 0x1FUL)));
+        }
+    }
+}
+
 /**
  * @brief Get a Tx event from the Tx event FIFO zone into the message RAM.
  * @param  [in]  MCANx                  Pointer to MCAN instance register base.
@@ -2114,52 +2481,66 @@ int32_t MCAN_GetTxEvent(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_event_t *pTxEvent)
             u32GetIndex = READ_REG32_BIT(MCANx->TXEFS, MCAN_TXEFS_EFGI) >> MCAN_TXEFS_EFGI_POS;
             u32TxEventAddr = MCAN_TX_EVT_FIFO_SA(MCANx) + (u32GetIndex * MCAN_TX_EVT_ES);
 
-            /* Retrieve ID type */
-            pTxEvent->IDE = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_XTD_MASK) >> MCAN_FRAME_XTD_POS;
-
-            /* Retrieve ID */
-            if (pTxEvent->IDE == MCAN_STD_ID) {
-                /* Standard ID element */
-                pTxEvent->ID = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_STDID_MASK) >> MCAN_FRAME_STDID_POS;
-            } else {
-                /* Extended ID element */
-                pTxEvent->ID = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_EXTID_MASK);
-            }
-
-            /* Retrieve Tx frame type */
-            pTxEvent->RTR = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_RTR_MASK) >> MCAN_FRAME_RTR_POS;
-
-            /* Retrieve ESI */
-            pTxEvent->ESI = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_ESI_MASK) >> MCAN_FRAME_ESI_POS;
+            MCAN_CopyTxEventFromRam(MCANx, u32TxEventAddr, pTxEvent);
 
-            /* Increment Tx event memory pointer to second word of Tx event FIFO element */
-            u32TxEventAddr += 4UL;
-
-            /* Retrieve DLC */
-            pTxEvent->DLC = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_DLC_MASK) >> MCAN_FRAME_DLC_POS;
+            /* Acknowledge the Tx event FIFO that the oldest element is
+               read so that it increments the get index. */
+            WRITE_REG32(MCANx->TXEFA, u32GetIndex);
+        }
+    }
 
-            /* Retrieve BRS */
-            pTxEvent->BRS = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_BRS_MASK) >> MCAN_FRAME_BRS_POS;
+    return i32Ret;
+}
 
-            /* Retrieve FDF */
-            pTxEvent->FDF = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_FDF_MASK) >> MCAN_FRAME_FDF_POS;
+/**
+ * @brief Get the Tx events from the Tx event FIFO zone into the message RAM and release them with one write.
+ * @param  [in]  MCANx                  Pointer to MCAN instance register base.
+ *                                      This parameter can be a value of the following:
+ *   @arg  CM_MCAN1:                    MCAN1 instance register base.
+ *   @arg  CM_MCAN2:                    MCAN2 instance register base.
+ * @param  [out] astcTxEvent            Pointer to a @ref stc_mcan_tx_event_t structure type array which is used to
+ *                                      save the Tx events, the oldest first.
+ * @param  [in]  u32MaxNum              Size of astcTxEvent.
+ * @param  [out] pu32GetNum             Pointer to the number of Tx events saved.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       astcTxEvent == NULL or pu32GetNum == NULL or u32MaxNum == 0;
+ *                                      The Tx event FIFO has no allocated area into the message RAM.
+ *           - LL_ERR_BUF_EMPTY:        The Tx event FIFO is empty.
+ */
+int32_t MCAN_GetTxEvents(CM_MCAN_TypeDef *MCANx, stc_mcan_tx_event_t astcTxEvent[],
+                         uint32_t u32MaxNum, uint32_t *pu32GetNum)
+{
+    uint32_t i;
+    uint32_t u32EvtNum;
+    uint32_t u32GetNum;
+    uint32_t u32GetIndex;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
 
-            /* Retrieve event type */
-            pTxEvent->u32EventType = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_ET_MASK) >> MCAN_FRAME_ET_POS;
+    DDL_ASSERT(IS_MCAN_UNIT(MCANx));
 
-            /* Retrieve message marker */
-            pTxEvent->u32MsgMarker = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_MM_L_MASK) >> MCAN_FRAME_MM_L_POS;
-            /* If 16-bit(wide) message marker used */
-            if (READ_REG32_BIT(MCANx->CCCR, MCAN_CCCR_WMM) != 0U) {
-                pTxEvent->u32MsgMarker |= READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_MM_H_MASK);
+    if ((astcTxEvent != NULL) && (pu32GetNum != NULL) && (u32MaxNum != 0U)) {
+        *pu32GetNum = 0U;
+        u32EvtNum = MCAN_GET_TX_EVT_FIFO_NUM(MCANx);
+        if (u32EvtNum != 0U) {
+            u32GetNum = READ_REG32_BIT(MCANx->TXEFS, MCAN_TXEFS_EFFL) >> MCAN_TXEFS_EFFL_POS;
+            u32GetNum = LL_MIN(u32GetNum, u32MaxNum);
+            if (u32GetNum == 0U) {
+                i32Ret = LL_ERR_BUF_EMPTY;
             } else {
-                /* Retrieve Tx timestamp. It is invalid if 16-bit(wide) message marker used. */
-                pTxEvent->u32TxTimestamp = READ_REG32_BIT(RW_MEM32(u32TxEventAddr), MCAN_FRAME_TS_MASK);
+                u32GetIndex = READ_REG32_BIT(MCANx->TXEFS, MCAN_TXEFS_EFGI) >> MCAN_TXEFS_EFGI_POS;
+                for (i = 0U; i < u32GetNum; i++) {
+                    if (i != 0U) {
+                        u32GetIndex = (u32GetIndex + 1U) % u32EvtNum;
+                    }
+                    MCAN_CopyTxEventFromRam(MCANx, MCAN_TX_EVT_FIFO_SA(MCANx) + (u32GetIndex * MCAN_TX_EVT_ES),
+                                            &astcTxEvent[i]);
+                }
+                /* Acknowledging the last element read releases all the elements before it. */
+                WRITE_REG32(MCANx->TXEFA, u32GetIndex);
+                *pu32GetNum = u32GetNum;
+                i32Ret = LL_OK;
             }
-
-            /* Acknowledge the Tx event FIFO that the oldest element is
-               read so that it increments the get index. */
-            WRITE_REG32(MCANx->TXEFA, u32GetIndex);
         }
     }
 
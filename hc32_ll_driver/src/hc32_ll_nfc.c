@@ -8,6 +8,8 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-11-08       CDT             Optimize function EXMC_NFC_ReadId
+   2026-10-18       CDT             Add page pipeline engine with cache read/program and DMA
+   2026-10-18       CDT             Add functions to get the page size, spare area size, page number and ECC mode
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -337,6 +339,30 @@
 
 #define EXMC_NFC_RMU_TIMEOUT                (100U)
 
+/**
+ * @defgroup EXMC_NFC_Pipe_Reference EXMC_NFC Page Pipeline Reference
+ * @{
+ */
+/*!< NFC_IENR register RBEN bit mask */
+#define NFC_INT_RB_BANKx_MASK(bank)         ((uint16_t)(EXMC_NFC_INT_RB_BANK0 << (EXMC_NFC_BANK7 & (bank))))
+
+/*!< Words moved by one DMA software request, the DMA block size is limited to 1024 */
+#define NFC_PIPE_DMA_BLOCK_MAX              (1024UL)
+
+/*!< Pipeline state */
+#define NFC_PIPE_IDLE                       (0U)    /*!< No job is running                                  */
+#define NFC_PIPE_WAIT_ARRAY                 (1U)    /*!< Waiting the first page read from the array (tR)    */
+#define NFC_PIPE_WAIT_CACHE                 (2U)    /*!< Waiting the cache register ready (tRCBSY/tCBSY)    */
+#define NFC_PIPE_DMA                        (3U)    /*!< DMA is moving the data register                    */
+
+/*!< FAIL and FAILC bits of the status byte */
+#define NFC_STATUS_PGM_FAIL                 (0x03UL)
+/*!< FAILC bit of the status byte: the page before the one in the cache register failed */
+#define NFC_STATUS_PGM_FAILC                (0x02UL)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -352,6 +378,14 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+#if (LL_DMA_ENABLE == DDL_ON)
+static CM_DMA_TypeDef *m_pstcNfcPipeDma = NULL;
+static uint8_t m_u8NfcPipeCh = 0U;
+static uint32_t m_u32NfcPipeBlockPages = 0UL;
+static __IO uint8_t m_u8NfcPipeState = NFC_PIPE_IDLE;
+static stc_exmc_nfc_job_t *m_pstcNfcJobHead = NULL;
+static stc_exmc_nfc_job_t *m_pstcNfcJobTail = NULL;
+#endif
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -452,6 +486,196 @@ static int32_t EXMC_NFC_WaitFlagUntilTo(uint32_t u32Flag, en_flag_status_t enSta
     return i32Ret;
 }
 
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Write the row address of the page to NFC_IDXR0/1, column 0.
+ * @param  [in] u32Bank                 The specified bank
+ * @param  [in] u32Page                 The specified page
+ * @retval None
+ */
+static void NFC_Pipe_WriteIndex(uint32_t u32Bank, uint32_t u32Page)
+{
+    const uint64_t u64Value = (NFC_IDXR_VAL(u32Bank, u32Page, 0UL, EXMC_NFC_GetCapacityIndex()) & NFC_IDXR_MASK);
+
+    WRITE_REG32(CM_NFC->IDXR0, (uint32_t)(u64Value & 0xFFFFFFFFUL));
+    WRITE_REG32(CM_NFC->IDXR1, (uint32_t)(u64Value >> 32UL));
+}
+
+/**
+ * @brief  Issue a command which drives RB low, the pipeline goes on when RB is high again.
+ * @param  [in] pstcJob                 Pointer to the running job.
+ * @param  [in] u32Cmd                  NFC_CMDR value.
+ * @param  [in] u8State                 Pipeline state while waiting RB.
+ * @retval None
+ */
+static void NFC_Pipe_WaitReady(const stc_exmc_nfc_job_t *pstcJob, uint32_t u32Cmd, uint8_t u8State)
+{
+    EXMC_NFC_ClearStatus(NFC_FLAG_RB_BANKx_MASK(pstcJob->u32Bank));
+    m_u8NfcPipeState = u8State;
+    WRITE_REG32(CM_NFC->CMDR, u32Cmd);
+}
+
+/**
+ * @brief  Move the next part of the current page between NFC_DATR and the job buffer.
+ * @param  [in] pstcJob                 Pointer to the running job.
+ * @retval None
+ * @note   NFC has no DMA request event, one software request moves one DMA block.
+ */
+static void NFC_Pipe_StartDma(stc_exmc_nfc_job_t *pstcJob)
+{
+    const uint32_t u32Block = LL_MIN((pstcJob->u32PageBytes / 4UL) - pstcJob->u32Offset, NFC_PIPE_DMA_BLOCK_MAX);
+    const uint32_t u32BufAddr = (uint32_t)pstcJob->pu8Data + (pstcJob->u32Index * pstcJob->u32PageBytes) +
+                                (pstcJob->u32Offset * 4UL);
+    const uint32_t u32DatrAddr = (uint32_t)(&CM_NFC->DATR_BASE);
+
+    if (EXMC_NFC_JOB_RD == pstcJob->u32Type) {
+        (void)DMA_SetSrcAddr(m_pstcNfcPipeDma, m_u8NfcPipeCh, u32DatrAddr);
+        (void)DMA_SetDestAddr(m_pstcNfcPipeDma, m_u8NfcPipeCh, u32BufAddr);
+    } else {
+        (void)DMA_SetSrcAddr(m_pstcNfcPipeDma, m_u8NfcPipeCh, u32BufAddr);
+        (void)DMA_SetDestAddr(m_pstcNfcPipeDma, m_u8NfcPipeCh, u32DatrAddr);
+    }
+    (void)DMA_SetBlockSize(m_pstcNfcPipeDma, m_u8NfcPipeCh, (uint16_t)u32Block);
+    (void)DMA_SetTransCount(m_pstcNfcPipeDma, m_u8NfcPipeCh, 1U);
+    pstcJob->u32Offset += u32Block;
+
+    m_u8NfcPipeState = NFC_PIPE_DMA;
+    (void)DMA_ChCmd(m_pstcNfcPipeDma, m_u8NfcPipeCh, ENABLE);
+    DMA_MxChSWTrigger(m_pstcNfcPipeDma, (uint8_t)(DMA_MX_CH0 << m_u8NfcPipeCh));
+}
+
+/**
+ * @brief  Start a page pipeline job.
+ * @param  [in] pstcJob                 Pointer to the job at the head of the queue.
+ * @retval None
+ */
+static void NFC_Pipe_StartJob(stc_exmc_nfc_job_t *pstcJob)
+{
+    stc_dma_init_t stcDmaInit;
+
+    (void)DMA_StructInit(&stcDmaInit);
+    stcDmaInit.u32IntEn = DMA_INT_ENABLE;
+    stcDmaInit.u32DataWidth = DMA_DATAWIDTH_32BIT;
+    stcDmaInit.u32BlockSize = 1UL;
+    stcDmaInit.u32TransCount = 1UL;
+    if (EXMC_NFC_JOB_RD == pstcJob->u32Type) {
+        stcDmaInit.u32SrcAddrInc = DMA_SRC_ADDR_FIX;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_INC;
+    } else {
+        stcDmaInit.u32SrcAddrInc = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+    }
+    (void)DMA_Init(m_pstcNfcPipeDma, m_u8NfcPipeCh, &stcDmaInit);
+
+    EXMC_NFC_EccCmd(DISABLE);
+    EXMC_NFC_IntCmd(NFC_INT_RB_BANKx_MASK(pstcJob->u32Bank), ENABLE);
+
+    if (EXMC_NFC_JOB_RD == pstcJob->u32Type) {
+        WRITE_REG32(CM_NFC->CMDR, EXMC_NFC_CMD_RD_1ST);
+        NFC_Pipe_WriteIndex(pstcJob->u32Bank, pstcJob->u32Page);
+        NFC_Pipe_WaitReady(pstcJob, EXMC_NFC_CMD_RD_2ND, NFC_PIPE_WAIT_ARRAY);
+    } else {
+        WRITE_REG32(CM_NFC->CMDR, EXMC_NFC_CMD_PAGE_CACHE_PROGRAM_1ST);
+        NFC_Pipe_WriteIndex(pstcJob->u32Bank, pstcJob->u32Page);
+        NFC_Pipe_StartDma(pstcJob);
+    }
+}
+
+/**
+ * @brief  Finish the running page pipeline job and start the next one.
+ * @param  [in] i32Result               Result of the running job.
+ * @retval None
+ */
+static void NFC_Pipe_FinishJob(int32_t i32Result)
+{
+    stc_exmc_nfc_job_t *pstcJob = m_pstcNfcJobHead;
+
+    (void)DMA_ChCmd(m_pstcNfcPipeDma, m_u8NfcPipeCh, DISABLE);
+    EXMC_NFC_IntCmd(NFC_INT_RB_BANKx_MASK(pstcJob->u32Bank), DISABLE);
+    EXMC_NFC_DeselectChip();
+    m_u8NfcPipeState = NFC_PIPE_IDLE;
+
+    m_pstcNfcJobHead = pstcJob->pstcNext;
+    if (NULL == m_pstcNfcJobHead) {
+        m_pstcNfcJobTail = NULL;
+    }
+    pstcJob->pstcNext = NULL;
+    pstcJob->i32Result = i32Result;
+    if (pstcJob->pfnCallback != NULL) {
+        pstcJob->pfnCallback();
+    }
+
+    if (NULL != m_pstcNfcJobHead) {
+        NFC_Pipe_StartJob(m_pstcNfcJobHead);
+    }
+}
+
+/**
+ * @brief  RB of the running job is high again.
+ * @param  [in] pstcJob                 Pointer to the running job.
+ * @retval None
+ */
+static void NFC_Pipe_OnReady(stc_exmc_nfc_job_t *pstcJob)
+{
+    if (EXMC_NFC_JOB_RD == pstcJob->u32Type) {
+        if ((NFC_PIPE_WAIT_ARRAY == m_u8NfcPipeState) && (pstcJob->u32PageNum > 1UL)) {
+            /* Copy the first page to the cache register and load the next page into the data register */
+            NFC_Pipe_WaitReady(pstcJob, EXMC_NFC_CMD_RD_CACHE_SEQ, NFC_PIPE_WAIT_CACHE);
+        } else {
+            /* The page is in the cache register, the array is loading the next page meanwhile */
+            NFC_Pipe_StartDma(pstcJob);
+        }
+    } else {
+        /* The page is in the cache register, the array is programming it meanwhile */
+        pstcJob->u32Index++;
+        pstcJob->u32Offset = 0UL;
+        if (pstcJob->u32Index == pstcJob->u32PageNum) {
+            /* Check the status of the last two pages */
+            if (0UL != (EXMC_NFC_ReadStatus(pstcJob->u32Bank) & NFC_STATUS_PGM_FAIL)) {
+                NFC_Pipe_FinishJob(LL_ERR);
+            } else {
+                NFC_Pipe_FinishJob(LL_OK);
+            }
+        } else if ((pstcJob->u32Index > 1UL) &&
+                   (0UL != (EXMC_NFC_ReadStatus(pstcJob->u32Bank) & NFC_STATUS_PGM_FAILC))) {
+            /* The page before the one just cached failed */
+            NFC_Pipe_FinishJob(LL_ERR);
+        } else {
+            WRITE_REG32(CM_NFC->CMDR, EXMC_NFC_CMD_PAGE_CACHE_PROGRAM_1ST);
+            NFC_Pipe_WriteIndex(pstcJob->u32Bank, pstcJob->u32Page + pstcJob->u32Index);
+            NFC_Pipe_StartDma(pstcJob);
+        }
+    }
+}
+
+/**
+ * @brief  DMA of the running job is completed.
+ * @param  [in] pstcJob                 Pointer to the running job.
+ * @retval None
+ */
+static void NFC_Pipe_OnDmaDone(stc_exmc_nfc_job_t *pstcJob)
+{
+    uint32_t u32Cmd;
+    const uint32_t u32Last = pstcJob->u32PageNum - 1UL;
+
+    if (pstcJob->u32Offset < (pstcJob->u32PageBytes / 4UL)) {
+        NFC_Pipe_StartDma(pstcJob);
+    } else if (EXMC_NFC_JOB_RD == pstcJob->u32Type) {
+        pstcJob->u32Index++;
+        pstcJob->u32Offset = 0UL;
+        if (pstcJob->u32Index > u32Last) {
+            NFC_Pipe_FinishJob(LL_OK);
+        } else {
+            u32Cmd = (pstcJob->u32Index == u32Last) ? EXMC_NFC_CMD_RD_CACHE_END : EXMC_NFC_CMD_RD_CACHE_SEQ;
+            NFC_Pipe_WaitReady(pstcJob, u32Cmd, NFC_PIPE_WAIT_CACHE);
+        }
+    } else {
+        u32Cmd = (pstcJob->u32Index == u32Last) ? EXMC_NFC_CMD_PAGE_PROGRAM_2ND : EXMC_NFC_CMD_PAGE_CACHE_PROGRAM_2ND;
+        NFC_Pipe_WaitReady(pstcJob, u32Cmd, NFC_PIPE_WAIT_CACHE);
+    }
+}
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @}
  */
@@ -905,6 +1129,48 @@ void EXMC_NFC_SetEccMode(uint32_t u32EccMode)
     MODIFY_REG32(CM_NFC->BACR, NFC_BACR_ECCM, u32EccMode);
 }
 
+/**
+ * @brief  Get NFC ECC mode.
+ * @param  None
+ * @retval Returned value can be one of the macros group @ref EXMC_NFC_ECC_Mode
+ *           - EXMC_NFC_1BIT_ECC:       1 bit ECC
+ *           - EXMC_NFC_4BIT_ECC:       4 bit ECC
+ */
+uint32_t EXMC_NFC_GetEccMode(void)
+{
+    return READ_REG32_BIT(CM_NFC->BACR, NFC_BACR_ECCM);
+}
+
+/**
+ * @brief  Get NFC page size.
+ * @param  None
+ * @retval The page size in bytes
+ */
+uint32_t EXMC_NFC_GetPageSize(void)
+{
+    return NFC_PAGE_SIZE;
+}
+
+/**
+ * @brief  Get NFC spare area size for user data.
+ * @param  None
+ * @retval The spare area size for user data in bytes
+ */
+uint32_t EXMC_NFC_GetSpareAreaSize(void)
+{
+    return NFC_SPARE_SIZE_FOR_USER_DATA;
+}
+
+/**
+ * @brief  Get the number of pages of one bank.
+ * @param  None
+ * @retval The number of pages for the configured bank capacity and page size
+ */
+uint32_t EXMC_NFC_GetPageNum(void)
+{
+    return NFC_PAGE_MAX(EXMC_NFC_GetCapacityIndex()) + 1UL;
+}
+
 /**
  * @brief  Get the 4 bits ECC syndrome register value.
  * @param  [in] u32Section              The syndrome section
@@ -1798,6 +2064,174 @@ int32_t EXMC_NFC_WritePageHwEcc(uint32_t u32Bank, uint32_t u32Page,
     return i32Ret;
 }
 
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Initialize the page pipeline engine.
+ * @param  [in] DMAx                    DMA unit instance.
+ * @param  [in] u8Ch                    DMA channel. @ref DMA_Channel_selection
+ * @param  [in] u32PagesPerBlock        Pages per block of the device.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       DMAx is NULL, u8Ch is invalid or u32PagesPerBlock is 0.
+ *           - LL_ERR_BUSY:             Jobs are still queued.
+ * @note   1)Call EXMC_NFC_Init() and enable the DMA unit by DMA_Cmd() first. The channel is started by
+ *           software request, its trigger source is not used.
+ *         2)Register INT_SRC_NFC_INT and the transfer complete interrupt of the DMA channel, and call
+ *           EXMC_NFC_PipeIrqHandler() in both interrupt handlers.
+ */
+int32_t EXMC_NFC_PipeInit(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, uint32_t u32PagesPerBlock)
+{
+    if ((NULL == DMAx) || (u8Ch > DMA_CH7) || (0UL == u32PagesPerBlock)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (NULL != m_pstcNfcJobHead) {
+        return LL_ERR_BUSY;
+    }
+
+    m_pstcNfcPipeDma = DMAx;
+    m_u8NfcPipeCh = u8Ch;
+    m_u32NfcPipeBlockPages = u32PagesPerBlock;
+    (void)DMA_ChCmd(DMAx, u8Ch, DISABLE);
+    DMA_ClearTransCompleteStatus(DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << u8Ch);
+    DMA_ClearErrStatus(DMAx, (DMA_FLAG_TRANS_ERR_CH0 | DMA_FLAG_REQ_ERR_CH0) << u8Ch);
+    DMA_TransCompleteIntCmd(DMAx, DMA_INT_TC_CH0 << u8Ch, ENABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  De-initialize the page pipeline engine.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   De-initialize successfully.
+ *           - LL_ERR_BUSY:             Jobs are still queued.
+ */
+int32_t EXMC_NFC_PipeDeInit(void)
+{
+    if (NULL != m_pstcNfcJobHead) {
+        return LL_ERR_BUSY;
+    }
+    if (NULL != m_pstcNfcPipeDma) {
+        DMA_TransCompleteIntCmd(m_pstcNfcPipeDma, DMA_INT_TC_CH0 << m_u8NfcPipeCh, DISABLE);
+        m_pstcNfcPipeDma = NULL;
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Queue a sequential page read or program job, it starts at once if the engine is idle.
+ * @param  [in] pstcJob                 Pointer to a @ref stc_exmc_nfc_job_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   The job is queued.
+ *           - LL_ERR_INVD_PARAM:       Invalid job, or its pages cross a block boundary.
+ *           - LL_ERR_NOT_RDY:          The engine is not initialized.
+ * @note   1)Reads use the cache read commands (31h/3Fh) and programs use the cache program command (15h),
+ *           so the DMA transfer of one page overlaps the array operation (tR/tPROG) of the neighbour page.
+ *           The pages of a job must be in one block and the device must support the cache commands.
+ *         2)Hardware ECC is not used, use EXMC_NFC_ReadPageHwEcc()/EXMC_NFC_WritePageHwEcc() for the
+ *           pages that need it.
+ *         3)Keep the other EXMC_NFC functions away from the device while a job is running.
+ */
+int32_t EXMC_NFC_PipeSubmit(stc_exmc_nfc_job_t *pstcJob)
+{
+    uint16_t u16IntEn;
+    const uint32_t u32CapacityIndex = EXMC_NFC_GetCapacityIndex();
+
+    if (NULL == pstcJob) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (NULL == m_pstcNfcPipeDma) {
+        return LL_ERR_NOT_RDY;
+    }
+    if (((EXMC_NFC_JOB_RD != pstcJob->u32Type) && (EXMC_NFC_JOB_PGM != pstcJob->u32Type)) ||
+        (!IS_EXMC_NFC_BANK(pstcJob->u32Bank)) || (0UL == pstcJob->u32PageNum) ||
+        (NULL == pstcJob->pu8Data) || (!IS_ADDR_ALIGN_WORD(pstcJob->pu8Data)) ||
+        (0UL == pstcJob->u32PageBytes) || (!IS_PARAM_ALIGN_WORD(pstcJob->u32PageBytes)) ||
+        (pstcJob->u32PageBytes > (NFC_PAGE_SIZE + NFC_SPARE_SIZE_FOR_USER_DATA))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if ((pstcJob->u32PageNum > (NFC_PAGE_MAX(u32CapacityIndex) + 1UL)) ||
+        (pstcJob->u32Page > (NFC_PAGE_MAX(u32CapacityIndex) + 1UL - pstcJob->u32PageNum))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    /* Cache commands do not cross a block */
+    if (((pstcJob->u32Page % m_u32NfcPipeBlockPages) + pstcJob->u32PageNum) > m_u32NfcPipeBlockPages) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcJob->i32Result = LL_ERR_BUSY;
+    pstcJob->u32Index = 0UL;
+    pstcJob->u32Offset = 0UL;
+    pstcJob->pstcNext = NULL;
+
+    /* Keep the ISR away from the queue while linking */
+    u16IntEn = (uint16_t)READ_REG16_BIT(CM_NFC->IENR, NFC_IENR_RBEN);
+    CLR_REG16_BIT(CM_NFC->IENR, NFC_IENR_RBEN);
+    DMA_TransCompleteIntCmd(m_pstcNfcPipeDma, DMA_INT_TC_CH0 << m_u8NfcPipeCh, DISABLE);
+    if (NULL == m_pstcNfcJobHead) {
+        m_pstcNfcJobHead = pstcJob;
+        m_pstcNfcJobTail = pstcJob;
+        NFC_Pipe_StartJob(pstcJob);
+    } else {
+        m_pstcNfcJobTail->pstcNext = pstcJob;
+        m_pstcNfcJobTail = pstcJob;
+    }
+    SET_REG16_BIT(CM_NFC->IENR, u16IntEn);
+    DMA_TransCompleteIntCmd(m_pstcNfcPipeDma, DMA_INT_TC_CH0 << m_u8NfcPipeCh, ENABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Page pipeline engine interrupt handler.
+ * @param  None
+ * @retval None
+ * @note   Call it in the NFC interrupt handler and the DMA channel transfer complete interrupt handler.
+ */
+void EXMC_NFC_PipeIrqHandler(void)
+{
+    stc_exmc_nfc_job_t *pstcJob = m_pstcNfcJobHead;
+    uint32_t u32TcFlag;
+    uint32_t u32ErrFlag;
+
+    if ((NULL == pstcJob) || (NULL == m_pstcNfcPipeDma)) {
+        return;
+    }
+
+    u32TcFlag = (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << m_u8NfcPipeCh;
+    u32ErrFlag = (DMA_FLAG_TRANS_ERR_CH0 | DMA_FLAG_REQ_ERR_CH0) << m_u8NfcPipeCh;
+    if (NFC_PIPE_DMA == m_u8NfcPipeState) {
+        if (SET == DMA_GetErrStatus(m_pstcNfcPipeDma, u32ErrFlag)) {
+            DMA_ClearErrStatus(m_pstcNfcPipeDma, u32ErrFlag);
+            NFC_Pipe_FinishJob(LL_ERR);
+        } else if (SET == DMA_GetTransCompleteStatus(m_pstcNfcPipeDma, DMA_FLAG_TC_CH0 << m_u8NfcPipeCh)) {
+            DMA_ClearTransCompleteStatus(m_pstcNfcPipeDma, u32TcFlag);
+            NFC_Pipe_OnDmaDone(pstcJob);
+        } else {
+            /* rsvd */
+        }
+    } else if (SET == EXMC_NFC_GetStatus(NFC_FLAG_RB_BANKx_MASK(pstcJob->u32Bank))) {
+        EXMC_NFC_ClearStatus(NFC_FLAG_RB_BANKx_MASK(pstcJob->u32Bank));
+        NFC_Pipe_OnReady(pstcJob);
+    } else {
+        /* rsvd */
+    }
+}
+
+/**
+ * @brief  Get the busy status of the page pipeline engine.
+ * @param  None
+ * @retval An @ref en_flag_status_t enumeration type value.
+ *           - SET:                     Jobs are queued or running.
+ *           - RESET:                   All jobs are finished.
+ */
+en_flag_status_t EXMC_NFC_PipeGetBusyStatus(void)
+{
+    return (NULL != m_pstcNfcJobHead) ? SET : RESET;
+}
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @}
  */
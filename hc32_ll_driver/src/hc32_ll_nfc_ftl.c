@@ -0,0 +1,1306 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_nfc_ftl.c
+ * @brief This file provides firmware functions to manage the flash translation
+ *        layer on top of the EXMC NFC (NAND Flash Controller) driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-18       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_nfc_ftl.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_EXMC
+ * @{
+ */
+
+/**
+ * @defgroup LL_NFC_FTL NFC_FTL
+ * @brief NAND Flash Translation Layer Driver Library
+ * @{
+ */
+
+#if (LL_NFC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup EXMC_NFC_FTL_Local_Types EXMC_NFC_FTL Local Types
+ * @{
+ */
+/**
+ * @brief  Flash translation layer tag in the spare area of each page
+ */
+typedef struct {
+    uint32_t u32BadMark;                /*!< Kept 0xFFFFFFFF, the bad block marker of the first page */
+    uint32_t u32Lpn;                    /*!< Logical page, or NFC_FTL_LPN_CKPT for a checkpoint page */
+    uint32_t u32Seq;                    /*!< Write sequence number */
+    uint32_t u32Info;                   /*!< Erase count of the block, or page index in a checkpoint */
+    uint32_t u32Check;                  /*!< Check word, NFC_FTL_TAG_CHECK() */
+} stc_nfc_ftl_tag_t;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EXMC_NFC_FTL_Local_Macros EXMC_NFC_FTL Local Macros
+ * @{
+ */
+
+/**
+ * @defgroup EXMC_NFC_FTL_Check_Parameters_Validity EXMC_NFC_FTL Check Parameters Validity
+ * @{
+ */
+#define IS_EXMC_NFC_FTL_BANK(x)             ((x) <= EXMC_NFC_BANK7)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EXMC_NFC_FTL_Reference EXMC_NFC_FTL Reference
+ * @{
+ */
+/*!< NFC page size */
+#define NFC_FTL_PAGE_SIZE                   (EXMC_NFC_GetPageSize())
+
+#define NFC_FTL_MAGIC                       (0x46544C31UL)  /*!< "FTL1", first word of a checkpoint */
+#define NFC_FTL_GOOD_MARK                   (0xFFFFFFFFUL)  /*!< First spare word of a good block */
+#define NFC_FTL_LPN_CKPT                    (0xFFFFFFFEUL)  /*!< Tag logical page of a checkpoint page */
+#define NFC_FTL_BLK_NONE                    (0xFFFFFFFFUL)
+
+#define NFC_FTL_TAG_WORDS                   (EXMC_NFC_FTL_SPARE_SIZE / 4UL)
+#define NFC_FTL_CKPT_HDR_WORDS              (4UL)
+#define NFC_FTL_CKPT_BLK_NUM                (2UL)
+#define NFC_FTL_PGM_RETRY                   (3UL)
+
+/*!< FAIL bit of the status byte */
+#define NFC_FTL_STATUS_FAIL                 (0x01UL)
+
+#define NFC_FTL_TAG_CHECK(tag)              (~((tag)->u32Lpn ^ (tag)->u32Seq ^ (tag)->u32Info))
+
+/*!< Device row of a page, and the page index in the FTL area used by the map */
+#define NFC_FTL_ROW(ftl, blk, page)         ((((ftl)->u32StartBlock + (blk)) * (ftl)->u32PagesPerBlock) + (page))
+#define NFC_FTL_PPN(ftl, blk, page)         (((blk) * (ftl)->u32PagesPerBlock) + (page))
+
+/*!< Pages of one checkpoint */
+#define NFC_FTL_CKPT_PAGE_NUM(ftl)                                             \
+(   ((((NFC_FTL_CKPT_HDR_WORDS + (ftl)->u32LogicPageNum + (ftl)->u32BlockNum) * 4UL) + NFC_FTL_PAGE_SIZE - 1UL) / \
+     NFC_FTL_PAGE_SIZE)                                                        \
+)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @defgroup EXMC_NFC_FTL_Local_Functions EXMC_NFC_FTL Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Read the tag of a page from the spare area.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Blk                  Block index in the FTL area.
+ * @param  [in] u32Page                 Page index in the block.
+ * @param  [out] pstcTag                Pointer to the tag.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_TIMEOUT:          Read timeout.
+ */
+static int32_t NFC_FTL_ReadTag(const stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Blk, uint32_t u32Page,
+                               stc_nfc_ftl_tag_t *pstcTag)
+{
+    stc_exmc_nfc_column_t stcColumn;
+
+    stcColumn.u32Bank = pstcFtl->u32Bank;
+    stcColumn.u32Page = NFC_FTL_ROW(pstcFtl, u32Blk, u32Page);
+    stcColumn.u32Column = NFC_FTL_PAGE_SIZE;
+
+    return EXMC_NFC_Read(&stcColumn, (uint32_t *)((uint32_t)pstcTag), NFC_FTL_TAG_WORDS, DISABLE,
+                         pstcFtl->u32Timeout);
+}
+
+/**
+ * @brief  Check whether a tag is intact.
+ * @param  [in] pstcTag                 Pointer to the tag.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t NFC_FTL_IsTagValid(const stc_nfc_ftl_tag_t *pstcTag)
+{
+    return ((NFC_FTL_GOOD_MARK == pstcTag->u32BadMark) && (NFC_FTL_TAG_CHECK(pstcTag) == pstcTag->u32Check)) ?
+           SET : RESET;
+}
+
+/**
+ * @brief  Check whether a tag is erased.
+ * @param  [in] pstcTag                 Pointer to the tag.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t NFC_FTL_IsTagBlank(const stc_nfc_ftl_tag_t *pstcTag)
+{
+    return ((0xFFFFFFFFUL == pstcTag->u32BadMark) && (0xFFFFFFFFUL == pstcTag->u32Lpn) &&
+            (0xFFFFFFFFUL == pstcTag->u32Seq) && (0xFFFFFFFFUL == pstcTag->u32Info) &&
+            (0xFFFFFFFFUL == pstcTag->u32Check)) ? SET : RESET;
+}
+
+/**
+ * @brief  Read a page with its tag into the page buffer by hardware ECC.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Blk                  Block index in the FTL area.
+ * @param  [in] u32Page                 Page index in the block.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred, single bit errors are corrected.
+ *           - LL_ERR:                  ECC error which can not be corrected.
+ *           - LL_ERR_TIMEOUT:          Read timeout.
+ * @note   The 4-bit ECC only reports the syndromes, a page with any error is reported as LL_ERR in this mode.
+ */
+static int32_t NFC_FTL_ReadPage(const stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Blk, uint32_t u32Page)
+{
+    uint32_t u32Section;
+    uint32_t u32Result;
+    uint32_t u32Byte;
+    const uint32_t u32Bytes = NFC_FTL_PAGE_SIZE + EXMC_NFC_FTL_SPARE_SIZE;
+    int32_t i32Ret;
+
+    i32Ret = EXMC_NFC_ReadPageHwEcc(pstcFtl->u32Bank, NFC_FTL_ROW(pstcFtl, u32Blk, u32Page),
+                                    pstcFtl->pu8PageBuf, u32Bytes, pstcFtl->u32Timeout);
+    if ((LL_OK != i32Ret) || (RESET == EXMC_NFC_GetStatus(EXMC_NFC_FLAG_ECC_ERR))) {
+        return i32Ret;
+    }
+    if (EXMC_NFC_1BIT_ECC != EXMC_NFC_GetEccMode()) {
+        return LL_ERR;
+    }
+
+    for (u32Section = 0UL; (u32Section <= EXMC_NFC_ECC_SECTION15) &&
+         ((u32Section * EXMC_NFC_ECC_CALCULATE_BLOCK_BYTE) < u32Bytes); u32Section++) {
+        u32Result = EXMC_NFC_Get1BitEccResult(u32Section);
+        if (0UL != (u32Result & EXMC_NFC_1BIT_ECC_MULTIPLE_BITS_ERR)) {
+            i32Ret = LL_ERR;
+        } else if (0UL != (u32Result & EXMC_NFC_1BIT_ECC_SINGLE_BIT_ERR)) {
+            u32Byte = (u32Section * EXMC_NFC_ECC_CALCULATE_BLOCK_BYTE) + EXMC_NFC_Get1BitEccErrByteLocation(u32Section);
+            /* An error in the ECC code itself is out of the buffer */
+            if (u32Byte < u32Bytes) {
+                pstcFtl->pu8PageBuf[u32Byte] ^= (uint8_t)(1UL << EXMC_NFC_Get1BitEccErrBitLocation(u32Section));
+            }
+        } else {
+            /* rsvd */
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Program the page buffer with its tag by hardware ECC.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Blk                  Block index in the FTL area.
+ * @param  [in] u32Page                 Page index in the block.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR:                  The device reports a program failure.
+ *           - LL_ERR_TIMEOUT:          Program timeout.
+ */
+static int32_t NFC_FTL_ProgramPage(const stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Blk, uint32_t u32Page)
+{
+    int32_t i32Ret;
+
+    i32Ret = EXMC_NFC_WritePageHwEcc(pstcFtl->u32Bank, NFC_FTL_ROW(pstcFtl, u32Blk, u32Page), pstcFtl->pu8PageBuf,
+                                     NFC_FTL_PAGE_SIZE + EXMC_NFC_FTL_SPARE_SIZE, pstcFtl->u32Timeout);
+    if ((LL_OK == i32Ret) && (0UL != (EXMC_NFC_ReadStatus(pstcFtl->u32Bank) & NFC_FTL_STATUS_FAIL))) {
+        i32Ret = LL_ERR;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Erase a block and count the erase.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Blk                  Block index in the FTL area.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR:                  The device reports an erase failure.
+ *           - LL_ERR_TIMEOUT:          Erase timeout.
+ */
+static int32_t NFC_FTL_EraseBlock(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Blk)
+{
+    stc_exmc_nfc_ftl_blk_t *pstcBlk = &pstcFtl->pstcBlk[u32Blk];
+    int32_t i32Ret;
+
+    i32Ret = EXMC_NFC_EraseBlock(pstcFtl->u32Bank, NFC_FTL_ROW(pstcFtl, u32Blk, 0UL), pstcFtl->u32Timeout);
+    if ((LL_OK == i32Ret) && (0UL != (EXMC_NFC_ReadStatus(pstcFtl->u32Bank) & NFC_FTL_STATUS_FAIL))) {
+        i32Ret = LL_ERR;
+    }
+    pstcBlk->u32EraseCount++;
+    pstcBlk->u32Seq = 0UL;
+    pstcBlk->u16ValidPages = 0U;
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Mark a block bad in the block table and in the bad block marker of its first page.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Blk                  Block index in the FTL area.
+ * @retval None
+ */
+static void NFC_FTL_MarkBad(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Blk)
+{
+    stc_exmc_nfc_column_t stcColumn;
+    const uint32_t au32Mark[1U] = {0UL};
+
+    stcColumn.u32Bank = pstcFtl->u32Bank;
+    stcColumn.u32Page = NFC_FTL_ROW(pstcFtl, u32Blk, 0UL);
+    stcColumn.u32Column = NFC_FTL_PAGE_SIZE;
+    (void)EXMC_NFC_Write(&stcColumn, au32Mark, 1UL, DISABLE, pstcFtl->u32Timeout);
+
+    pstcFtl->pstcBlk[u32Blk].u16State = EXMC_NFC_FTL_BLK_BAD;
+    pstcFtl->pstcBlk[u32Blk].u16ValidPages = 0U;
+}
+
+/**
+ * @brief  Take the free block with the least erases as the active block.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval The block index, NFC_FTL_BLK_NONE if no block is free.
+ */
+static uint32_t NFC_FTL_AllocBlock(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32Blk = NFC_FTL_BLK_NONE;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk = pstcFtl->pstcBlk;
+
+    for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+        if ((EXMC_NFC_FTL_BLK_FREE == pstcBlk[i].u16State) &&
+            ((NFC_FTL_BLK_NONE == u32Blk) || (pstcBlk[i].u32EraseCount < pstcBlk[u32Blk].u32EraseCount))) {
+            u32Blk = i;
+        }
+    }
+    if (NFC_FTL_BLK_NONE != u32Blk) {
+        pstcBlk[u32Blk].u16State = EXMC_NFC_FTL_BLK_ACTIVE;
+        pstcFtl->u32FreeBlockNum--;
+    }
+
+    return u32Blk;
+}
+
+/**
+ * @brief  Program the page buffer to the next free page of the active block.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Lpn                  Logical page of the data.
+ * @param  [out] pu32Ppn                Physical page programmed.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_BUF_FULL:         No free block is left.
+ *           - LL_ERR:                  Program failed on the retries.
+ * @note   A block failing the program is retired, the page goes to a new block.
+ */
+static int32_t NFC_FTL_Append(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Lpn, uint32_t *pu32Ppn)
+{
+    uint32_t u32Retry = 0UL;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk;
+    stc_nfc_ftl_tag_t *pstcTag = (stc_nfc_ftl_tag_t *)((uint32_t)&pstcFtl->pu8PageBuf[NFC_FTL_PAGE_SIZE]);
+    int32_t i32Ret;
+
+    do {
+        if (pstcFtl->u32ActivePage >= pstcFtl->u32PagesPerBlock) {
+            if ((NFC_FTL_BLK_NONE != pstcFtl->u32ActiveBlock) &&
+                (EXMC_NFC_FTL_BLK_ACTIVE == pstcFtl->pstcBlk[pstcFtl->u32ActiveBlock].u16State)) {
+                pstcFtl->pstcBlk[pstcFtl->u32ActiveBlock].u16State = EXMC_NFC_FTL_BLK_USED;
+            }
+            pstcFtl->u32ActiveBlock = NFC_FTL_AllocBlock(pstcFtl);
+            pstcFtl->u32ActivePage = 0UL;
+            if (NFC_FTL_BLK_NONE == pstcFtl->u32ActiveBlock) {
+                pstcFtl->u32ActivePage = pstcFtl->u32PagesPerBlock;
+                return LL_ERR_BUF_FULL;
+            }
+        }
+
+        pstcBlk = &pstcFtl->pstcBlk[pstcFtl->u32ActiveBlock];
+        pstcFtl->u32Seq++;
+        if (0UL == pstcFtl->u32ActivePage) {
+            pstcBlk->u32Seq = pstcFtl->u32Seq;
+        }
+        pstcTag->u32BadMark = NFC_FTL_GOOD_MARK;
+        pstcTag->u32Lpn = u32Lpn;
+        pstcTag->u32Seq = pstcFtl->u32Seq;
+        pstcTag->u32Info = pstcBlk->u32EraseCount;
+        pstcTag->u32Check = NFC_FTL_TAG_CHECK(pstcTag);
+
+        i32Ret = NFC_FTL_ProgramPage(pstcFtl, pstcFtl->u32ActiveBlock, pstcFtl->u32ActivePage);
+        *pu32Ppn = NFC_FTL_PPN(pstcFtl, pstcFtl->u32ActiveBlock, pstcFtl->u32ActivePage);
+        pstcFtl->u32ActivePage++;
+        if (LL_OK != i32Ret) {
+            /* Its valid pages are moved by the next collection */
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_RETIRE;
+            pstcFtl->u32ActivePage = pstcFtl->u32PagesPerBlock;
+            u32Retry++;
+        }
+    } while ((LL_OK != i32Ret) && (u32Retry < NFC_FTL_PGM_RETRY));
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Write the page buffer as the new copy of a logical page.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Lpn                  Logical page.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_BUF_FULL:         No free block is left.
+ *           - LL_ERR:                  Program failed.
+ */
+static int32_t NFC_FTL_Update(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Lpn)
+{
+    uint32_t u32Ppn = EXMC_NFC_FTL_UNMAPPED;
+    stc_exmc_nfc_ftl_blk_t *pstcOld;
+    const uint32_t u32Old = pstcFtl->pu32Map[u32Lpn];
+    int32_t i32Ret;
+
+    i32Ret = NFC_FTL_Append(pstcFtl, u32Lpn, &u32Ppn);
+    if (LL_OK == i32Ret) {
+        if (EXMC_NFC_FTL_UNMAPPED != u32Old) {
+            pstcOld = &pstcFtl->pstcBlk[u32Old / pstcFtl->u32PagesPerBlock];
+            pstcOld->u16ValidPages--;
+            if ((EXMC_NFC_FTL_BLK_DAMAGED == pstcOld->u16State) && (0U == pstcOld->u16ValidPages)) {
+                /* Nothing is left to lose, the next collection marks it bad */
+                pstcOld->u16State = EXMC_NFC_FTL_BLK_RETIRE;
+            }
+        }
+        pstcFtl->pu32Map[u32Lpn] = u32Ppn;
+        pstcFtl->pstcBlk[u32Ppn / pstcFtl->u32PagesPerBlock].u16ValidPages++;
+        pstcFtl->u32DirtyPages++;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Check whether garbage needs to be collected before the next write.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t NFC_FTL_IsGcNeeded(const stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    return (pstcFtl->u32FreeBlockNum < EXMC_NFC_FTL_GC_THRESHOLD) ? SET : RESET;
+}
+
+/**
+ * @brief  Pick the block to be collected: a retired block, or the written block with the least valid pages.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval The block index, NFC_FTL_BLK_NONE if no block gives space back.
+ */
+static uint32_t NFC_FTL_PickVictim(const stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32Victim = NFC_FTL_BLK_NONE;
+    const stc_exmc_nfc_ftl_blk_t *pstcBlk = pstcFtl->pstcBlk;
+
+    for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+        if (EXMC_NFC_FTL_BLK_RETIRE == pstcBlk[i].u16State) {
+            return i;
+        }
+        if ((EXMC_NFC_FTL_BLK_USED == pstcBlk[i].u16State) &&
+            ((NFC_FTL_BLK_NONE == u32Victim) || (pstcBlk[i].u16ValidPages < pstcBlk[u32Victim].u16ValidPages))) {
+            u32Victim = i;
+        }
+    }
+    if ((NFC_FTL_BLK_NONE != u32Victim) && (pstcBlk[u32Victim].u16ValidPages >= pstcFtl->u32PagesPerBlock)) {
+        u32Victim = NFC_FTL_BLK_NONE;
+    }
+
+    return u32Victim;
+}
+
+/**
+ * @brief  Pick the written block with the least erases if the erase counts spread too far.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval The block index, NFC_FTL_BLK_NONE if no cold data needs to move.
+ */
+static uint32_t NFC_FTL_PickCold(const stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32Cold = NFC_FTL_BLK_NONE;
+    uint32_t u32MaxErase = 0UL;
+    const stc_exmc_nfc_ftl_blk_t *pstcBlk = pstcFtl->pstcBlk;
+
+    for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+        if (EXMC_NFC_FTL_BLK_BAD != pstcBlk[i].u16State) {
+            u32MaxErase = LL_MAX(u32MaxErase, pstcBlk[i].u32EraseCount);
+        }
+        if ((EXMC_NFC_FTL_BLK_USED == pstcBlk[i].u16State) &&
+            ((NFC_FTL_BLK_NONE == u32Cold) || (pstcBlk[i].u32EraseCount < pstcBlk[u32Cold].u32EraseCount))) {
+            u32Cold = i;
+        }
+    }
+    if ((NFC_FTL_BLK_NONE != u32Cold) && ((u32MaxErase - pstcBlk[u32Cold].u32EraseCount) <= EXMC_NFC_FTL_WEAR_LIMIT)) {
+        u32Cold = NFC_FTL_BLK_NONE;
+    }
+
+    return u32Cold;
+}
+
+/**
+ * @brief  Move the valid pages out of a block, then erase it.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Blk                  Block index in the FTL area.
+ * @retval int32_t:
+ *           - LL_OK:                   The block is free or marked bad.
+ *           - LL_ERR_BUF_FULL:         No free block is left for the valid pages.
+ *           - LL_ERR:                  A valid page can not be programmed, or can not be read or found by its tag.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   1)A tag read raw with bit errors is read again with ECC.
+ *         2)The readable pages are moved even if some valid page can not be read or found. The block is then
+ *           kept as EXMC_NFC_FTL_BLK_DAMAGED, which is not picked again, until those pages are rewritten.
+ */
+static int32_t NFC_FTL_Collect(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Blk)
+{
+    uint32_t i;
+    uint32_t u32Loaded;
+    stc_nfc_ftl_tag_t stcTag;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk = &pstcFtl->pstcBlk[u32Blk];
+    const stc_nfc_ftl_tag_t *pstcBufTag =
+        (const stc_nfc_ftl_tag_t *)((uint32_t)&pstcFtl->pu8PageBuf[NFC_FTL_PAGE_SIZE]);
+    int32_t i32Ret = LL_OK;
+
+    for (i = 0UL; (i < pstcFtl->u32PagesPerBlock) && (0U != pstcBlk->u16ValidPages) && (LL_OK == i32Ret); i++) {
+        u32Loaded = 0UL;
+        i32Ret = NFC_FTL_ReadTag(pstcFtl, u32Blk, i, &stcTag);
+        if ((LL_OK == i32Ret) && (RESET == NFC_FTL_IsTagValid(&stcTag)) && (RESET == NFC_FTL_IsTagBlank(&stcTag))) {
+            /* Bit errors in the raw tag, take the tag corrected by ECC */
+            if (LL_OK == NFC_FTL_ReadPage(pstcFtl, u32Blk, i)) {
+                stcTag = *pstcBufTag;
+                u32Loaded = 1UL;
+            }
+        }
+        if ((LL_OK == i32Ret) && (SET == NFC_FTL_IsTagValid(&stcTag)) &&
+            (stcTag.u32Lpn < pstcFtl->u32LogicPageNum) &&
+            (pstcFtl->pu32Map[stcTag.u32Lpn] == NFC_FTL_PPN(pstcFtl, u32Blk, i))) {
+            if (0UL == u32Loaded) {
+                i32Ret = NFC_FTL_ReadPage(pstcFtl, u32Blk, i);
+            }
+            if (LL_OK == i32Ret) {
+                i32Ret = NFC_FTL_Update(pstcFtl, stcTag.u32Lpn);
+            } else if (LL_ERR == i32Ret) {
+                /* Uncorrectable, the page stays mapped here */
+                i32Ret = LL_OK;
+            } else {
+                /* rsvd */
+            }
+        }
+    }
+    if (LL_OK != i32Ret) {
+        return i32Ret;
+    }
+    if (0U != pstcBlk->u16ValidPages) {
+        /* Erasing the block would lose the pages left, skip it */
+        pstcBlk->u16State = EXMC_NFC_FTL_BLK_DAMAGED;
+        return LL_ERR;
+    }
+
+    if ((EXMC_NFC_FTL_BLK_RETIRE == pstcBlk->u16State) || (LL_OK != NFC_FTL_EraseBlock(pstcFtl, u32Blk))) {
+        NFC_FTL_MarkBad(pstcFtl, u32Blk);
+    } else {
+        pstcBlk->u16State = EXMC_NFC_FTL_BLK_FREE;
+        pstcFtl->u32FreeBlockNum++;
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Get a word of the checkpoint: header, logical to physical map, then the erase counts.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Index                Word index in the checkpoint.
+ * @retval The word.
+ */
+static uint32_t NFC_FTL_CkptWord(const stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Index)
+{
+    uint32_t u32Word;
+    const uint32_t u32MapEnd = NFC_FTL_CKPT_HDR_WORDS + pstcFtl->u32LogicPageNum;
+
+    if (0UL == u32Index) {
+        u32Word = NFC_FTL_MAGIC;
+    } else if (1UL == u32Index) {
+        u32Word = pstcFtl->u32ActiveBlock;
+    } else if (2UL == u32Index) {
+        u32Word = pstcFtl->u32LogicPageNum;
+    } else if (3UL == u32Index) {
+        u32Word = pstcFtl->u32BlockNum;
+    } else if (u32Index < u32MapEnd) {
+        u32Word = pstcFtl->pu32Map[u32Index - NFC_FTL_CKPT_HDR_WORDS];
+    } else if (u32Index < (u32MapEnd + pstcFtl->u32BlockNum)) {
+        u32Word = pstcFtl->pstcBlk[u32Index - u32MapEnd].u32EraseCount;
+    } else {
+        u32Word = 0xFFFFFFFFUL;
+    }
+
+    return u32Word;
+}
+
+/**
+ * @brief  Check the FTL definition.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   The definition fits the device.
+ *           - LL_ERR_INVD_PARAM:       Invalid definition.
+ */
+static int32_t NFC_FTL_CheckParam(const stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    if ((NULL == pstcFtl) || (NULL == pstcFtl->pu32Map) || (NULL == pstcFtl->pstcBlk) ||
+        (NULL == pstcFtl->pu8PageBuf) || (!IS_ADDR_ALIGN_WORD(pstcFtl->pu8PageBuf))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if ((!IS_EXMC_NFC_FTL_BANK(pstcFtl->u32Bank)) || (0UL == pstcFtl->u32LogicPageNum) ||
+        (0UL == pstcFtl->u32PagesPerBlock) || (pstcFtl->u32PagesPerBlock > 0xFFFFUL) ||
+        (pstcFtl->u32BlockNum < (NFC_FTL_CKPT_BLK_NUM + EXMC_NFC_FTL_GC_THRESHOLD + 2UL)) ||
+        (EXMC_NFC_GetSpareAreaSize() < EXMC_NFC_FTL_SPARE_SIZE) ||
+        (NFC_FTL_CKPT_PAGE_NUM(pstcFtl) > pstcFtl->u32PagesPerBlock)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (((pstcFtl->u32StartBlock + pstcFtl->u32BlockNum) * pstcFtl->u32PagesPerBlock) >
+        EXMC_NFC_GetPageNum()) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Check whether the good blocks hold the logical pages with the collection reserve.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t NFC_FTL_IsCapacityOk(const stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32DataNum = 0UL;
+    uint32_t u32CkptNum = 0UL;
+
+    for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+        if (EXMC_NFC_FTL_BLK_CKPT == pstcFtl->pstcBlk[i].u16State) {
+            u32CkptNum++;
+        } else if (EXMC_NFC_FTL_BLK_BAD != pstcFtl->pstcBlk[i].u16State) {
+            u32DataNum++;
+        } else {
+            /* rsvd */
+        }
+    }
+
+    /* The active block and the collection reserve are not counted in the logical space */
+    return ((NFC_FTL_CKPT_BLK_NUM == u32CkptNum) && (u32DataNum > (EXMC_NFC_FTL_GC_THRESHOLD + 1UL)) &&
+            (pstcFtl->u32LogicPageNum <=
+             ((u32DataNum - EXMC_NFC_FTL_GC_THRESHOLD - 1UL) * pstcFtl->u32PagesPerBlock))) ? SET : RESET;
+}
+
+/**
+ * @brief  Build the block table from the tag of the first page of each block.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   A checkpoint block is found by the tag of its first page. A block with a torn first page is erased.
+ */
+static int32_t NFC_FTL_ScanBlocks(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    stc_nfc_ftl_tag_t stcTag;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk;
+    int32_t i32Ret = LL_OK;
+
+    pstcFtl->u32FreeBlockNum = 0UL;
+    for (i = 0UL; (i < pstcFtl->u32BlockNum) && (LL_OK == i32Ret); i++) {
+        pstcBlk = &pstcFtl->pstcBlk[i];
+        pstcBlk->u32EraseCount = 0UL;
+        pstcBlk->u32Seq = 0UL;
+        pstcBlk->u16ValidPages = 0U;
+        pstcBlk->u16State = EXMC_NFC_FTL_BLK_FREE;
+
+        i32Ret = NFC_FTL_ReadTag(pstcFtl, i, 0UL, &stcTag);
+        if (LL_OK != i32Ret) {
+            /* rsvd */
+        } else if (NFC_FTL_GOOD_MARK != stcTag.u32BadMark) {
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_BAD;
+        } else if ((SET == NFC_FTL_IsTagValid(&stcTag)) && (NFC_FTL_LPN_CKPT == stcTag.u32Lpn)) {
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_CKPT;
+            pstcBlk->u32Seq = stcTag.u32Seq;
+        } else if (SET == NFC_FTL_IsTagValid(&stcTag)) {
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_USED;
+            pstcBlk->u32EraseCount = stcTag.u32Info;
+            pstcBlk->u32Seq = stcTag.u32Seq;
+        } else if ((RESET == NFC_FTL_IsTagBlank(&stcTag)) && (LL_OK != NFC_FTL_EraseBlock(pstcFtl, i))) {
+            NFC_FTL_MarkBad(pstcFtl, i);
+        } else {
+            pstcFtl->u32FreeBlockNum++;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Take the checkpoint blocks found by the scan, a missing one is taken from the free blocks.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval None
+ * @note   A block erased for a checkpoint but not yet written is found as free. A third checkpoint block is
+ *         left when the bad block marker of a replaced one was not written, the oldest one is erased.
+ */
+static void NFC_FTL_PickCkptBlocks(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32Blk;
+    uint32_t u32Index;
+    uint32_t u32CkptNum = 0UL;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk = pstcFtl->pstcBlk;
+
+    for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+        if (EXMC_NFC_FTL_BLK_CKPT != pstcBlk[i].u16State) {
+            continue;
+        }
+        if (u32CkptNum < NFC_FTL_CKPT_BLK_NUM) {
+            pstcFtl->au32CkptBlock[u32CkptNum] = i;
+            u32CkptNum++;
+            continue;
+        }
+
+        u32Index = (pstcBlk[pstcFtl->au32CkptBlock[0U]].u32Seq < pstcBlk[pstcFtl->au32CkptBlock[1U]].u32Seq) ?
+                   0UL : 1UL;
+        u32Blk = i;
+        if (pstcBlk[i].u32Seq > pstcBlk[pstcFtl->au32CkptBlock[u32Index]].u32Seq) {
+            u32Blk = pstcFtl->au32CkptBlock[u32Index];
+            pstcFtl->au32CkptBlock[u32Index] = i;
+        }
+        if (LL_OK != NFC_FTL_EraseBlock(pstcFtl, u32Blk)) {
+            NFC_FTL_MarkBad(pstcFtl, u32Blk);
+        } else {
+            pstcBlk[u32Blk].u16State = EXMC_NFC_FTL_BLK_FREE;
+            pstcFtl->u32FreeBlockNum++;
+        }
+    }
+
+    for (; u32CkptNum < NFC_FTL_CKPT_BLK_NUM; u32CkptNum++) {
+        u32Blk = NFC_FTL_AllocBlock(pstcFtl);
+        if (NFC_FTL_BLK_NONE == u32Blk) {
+            break;
+        }
+        pstcBlk[u32Blk].u16State = EXMC_NFC_FTL_BLK_CKPT;
+        pstcFtl->au32CkptBlock[u32CkptNum] = u32Blk;
+    }
+}
+
+/**
+ * @brief  Replace a checkpoint block which failed the erase or program by a free block.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Index                Index in au32CkptBlock of the failed block.
+ * @retval int32_t:
+ *           - LL_OK:                   The failed block is marked bad, the new block is erased.
+ *           - LL_ERR_BUF_FULL:         No free block is left, the failed block is kept.
+ */
+static int32_t NFC_FTL_ReplaceCkptBlock(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Index)
+{
+    const uint32_t u32Blk = NFC_FTL_AllocBlock(pstcFtl);
+
+    if (NFC_FTL_BLK_NONE == u32Blk) {
+        return LL_ERR_BUF_FULL;
+    }
+    NFC_FTL_MarkBad(pstcFtl, pstcFtl->au32CkptBlock[u32Index]);
+    pstcFtl->pstcBlk[u32Blk].u16State = EXMC_NFC_FTL_BLK_CKPT;
+    pstcFtl->au32CkptBlock[u32Index] = u32Blk;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Program the pages of a checkpoint to the current checkpoint block.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32PageNum              Pages of the checkpoint.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR:                  The device reports a program failure.
+ *           - LL_ERR_TIMEOUT:          Program timeout.
+ */
+static int32_t NFC_FTL_ProgramCkpt(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32PageNum)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t *pu32Buf = (uint32_t *)((uint32_t)pstcFtl->pu8PageBuf);
+    stc_nfc_ftl_tag_t *pstcTag = (stc_nfc_ftl_tag_t *)((uint32_t)&pstcFtl->pu8PageBuf[NFC_FTL_PAGE_SIZE]);
+    const uint32_t u32Blk = pstcFtl->au32CkptBlock[pstcFtl->u32CkptCurr];
+    const uint32_t u32PageWords = NFC_FTL_PAGE_SIZE / 4UL;
+    int32_t i32Ret = LL_OK;
+
+    for (i = 0UL; (i < u32PageNum) && (LL_OK == i32Ret); i++) {
+        for (j = 0UL; j < u32PageWords; j++) {
+            pu32Buf[j] = NFC_FTL_CkptWord(pstcFtl, (i * u32PageWords) + j);
+        }
+        pstcTag->u32BadMark = NFC_FTL_GOOD_MARK;
+        pstcTag->u32Lpn = NFC_FTL_LPN_CKPT;
+        pstcTag->u32Seq = pstcFtl->u32Seq;
+        pstcTag->u32Info = i;
+        pstcTag->u32Check = NFC_FTL_TAG_CHECK(pstcTag);
+        i32Ret = NFC_FTL_ProgramPage(pstcFtl, u32Blk, pstcFtl->u32CkptPage);
+        pstcFtl->u32CkptPage++;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Find the newest complete checkpoint.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [out] pu32StartPage          First page of the checkpoint in the current checkpoint block.
+ * @retval Sequence number of the checkpoint, 0 if none is found.
+ */
+static uint32_t NFC_FTL_FindCkpt(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t *pu32StartPage)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t u32Start = 0UL;
+    uint32_t u32Seq = 0UL;
+    uint32_t u32Newest = 0UL;
+    uint32_t au32FreePage[NFC_FTL_CKPT_BLK_NUM];
+    stc_nfc_ftl_tag_t stcTag;
+    const uint32_t u32PageNum = NFC_FTL_CKPT_PAGE_NUM(pstcFtl);
+
+    pstcFtl->u32CkptCurr = 0UL;
+    for (i = 0UL; i < NFC_FTL_CKPT_BLK_NUM; i++) {
+        au32FreePage[i] = pstcFtl->u32PagesPerBlock;
+        for (j = 0UL; j < pstcFtl->u32PagesPerBlock; j++) {
+            if (LL_OK != NFC_FTL_ReadTag(pstcFtl, pstcFtl->au32CkptBlock[i], j, &stcTag)) {
+                break;
+            }
+            if (SET == NFC_FTL_IsTagBlank(&stcTag)) {
+                au32FreePage[i] = j;
+                break;
+            }
+            if ((SET == NFC_FTL_IsTagValid(&stcTag)) && (NFC_FTL_LPN_CKPT == stcTag.u32Lpn)) {
+                pstcFtl->u32Seq = LL_MAX(pstcFtl->u32Seq, stcTag.u32Seq);
+                if (0UL == stcTag.u32Info) {
+                    u32Start = j;
+                    u32Seq = stcTag.u32Seq;
+                }
+                /* The checkpoint is complete when its last page is programmed */
+                if (((u32PageNum - 1UL) == stcTag.u32Info) && ((u32Start + stcTag.u32Info) == j) &&
+                    (u32Seq == stcTag.u32Seq) && (u32Seq > u32Newest)) {
+                    u32Newest = u32Seq;
+                    *pu32StartPage = u32Start;
+                    pstcFtl->u32CkptCurr = i;
+                }
+            }
+        }
+    }
+    pstcFtl->u32CkptPage = au32FreePage[pstcFtl->u32CkptCurr];
+
+    return u32Newest;
+}
+
+/**
+ * @brief  Load the map and the erase counts from a checkpoint.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32StartPage            First page of the checkpoint in the current checkpoint block.
+ * @param  [out] pu32Active             Active block at the checkpoint.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR:                  Unreadable checkpoint, or it was made for another geometry.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ */
+static int32_t NFC_FTL_LoadCkpt(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32StartPage, uint32_t *pu32Active)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t u32Index;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk;
+    const uint32_t *pu32Buf = (const uint32_t *)((uint32_t)pstcFtl->pu8PageBuf);
+    const uint32_t u32PageWords = NFC_FTL_PAGE_SIZE / 4UL;
+    const uint32_t u32MapEnd = NFC_FTL_CKPT_HDR_WORDS + pstcFtl->u32LogicPageNum;
+    int32_t i32Ret = LL_OK;
+
+    for (i = 0UL; (i < NFC_FTL_CKPT_PAGE_NUM(pstcFtl)) && (LL_OK == i32Ret); i++) {
+        i32Ret = NFC_FTL_ReadPage(pstcFtl, pstcFtl->au32CkptBlock[pstcFtl->u32CkptCurr], u32StartPage + i);
+        for (j = 0UL; (j < u32PageWords) && (LL_OK == i32Ret); j++) {
+            u32Index = (i * u32PageWords) + j;
+            if (1UL == u32Index) {
+                *pu32Active = pu32Buf[j];
+            } else if (u32Index < NFC_FTL_CKPT_HDR_WORDS) {
+                if (NFC_FTL_CkptWord(pstcFtl, u32Index) != pu32Buf[j]) {
+                    i32Ret = LL_ERR;
+                }
+            } else if (u32Index < u32MapEnd) {
+                pstcFtl->pu32Map[u32Index - NFC_FTL_CKPT_HDR_WORDS] = pu32Buf[j];
+            } else if (u32Index < (u32MapEnd + pstcFtl->u32BlockNum)) {
+                pstcBlk = &pstcFtl->pstcBlk[u32Index - u32MapEnd];
+                pstcBlk->u32EraseCount = LL_MAX(pstcBlk->u32EraseCount, pu32Buf[j]);
+            } else {
+                /* rsvd */
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Apply the pages written since the checkpoint to the map, block by block in write order.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32CkptActive           Active block at the checkpoint.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ */
+static int32_t NFC_FTL_Replay(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32CkptActive)
+{
+    uint32_t i;
+    uint32_t u32Blk;
+    uint32_t u32PrevSeq = 0UL;
+    en_flag_status_t enBlank;
+    stc_nfc_ftl_tag_t stcTag;
+    const stc_exmc_nfc_ftl_blk_t *pstcBlk = pstcFtl->pstcBlk;
+    int32_t i32Ret = LL_OK;
+
+    do {
+        u32Blk = NFC_FTL_BLK_NONE;
+        for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+            if ((EXMC_NFC_FTL_BLK_USED == pstcBlk[i].u16State) && (pstcBlk[i].u32Seq > u32PrevSeq) &&
+                ((pstcBlk[i].u32Seq > pstcFtl->u32CkptSeq) || (i == u32CkptActive)) &&
+                ((NFC_FTL_BLK_NONE == u32Blk) || (pstcBlk[i].u32Seq < pstcBlk[u32Blk].u32Seq))) {
+                u32Blk = i;
+            }
+        }
+
+        if (NFC_FTL_BLK_NONE != u32Blk) {
+            u32PrevSeq = pstcBlk[u32Blk].u32Seq;
+            enBlank = RESET;
+            /* Pages are programmed in order, the first blank page ends the block */
+            for (i = 0UL; (i < pstcFtl->u32PagesPerBlock) && (RESET == enBlank) && (LL_OK == i32Ret); i++) {
+                i32Ret = NFC_FTL_ReadTag(pstcFtl, u32Blk, i, &stcTag);
+                enBlank = NFC_FTL_IsTagBlank(&stcTag);
+                if ((LL_OK == i32Ret) && (SET == NFC_FTL_IsTagValid(&stcTag))) {
+                    pstcFtl->u32Seq = LL_MAX(pstcFtl->u32Seq, stcTag.u32Seq);
+                    if (stcTag.u32Lpn < pstcFtl->u32LogicPageNum) {
+                        pstcFtl->pu32Map[stcTag.u32Lpn] = NFC_FTL_PPN(pstcFtl, u32Blk, i);
+                        pstcFtl->u32DirtyPages++;
+                    }
+                }
+            }
+        }
+    } while ((NFC_FTL_BLK_NONE != u32Blk) && (LL_OK == i32Ret));
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Count the valid pages of each block from the map.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval None
+ */
+static void NFC_FTL_CountValid(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32Blk;
+
+    for (i = 0UL; i < pstcFtl->u32LogicPageNum; i++) {
+        if (EXMC_NFC_FTL_UNMAPPED != pstcFtl->pu32Map[i]) {
+            u32Blk = pstcFtl->pu32Map[i] / pstcFtl->u32PagesPerBlock;
+            if ((u32Blk < pstcFtl->u32BlockNum) && (EXMC_NFC_FTL_BLK_USED == pstcFtl->pstcBlk[u32Blk].u16State)) {
+                pstcFtl->pstcBlk[u32Blk].u16ValidPages++;
+            } else {
+                pstcFtl->pu32Map[i] = EXMC_NFC_FTL_UNMAPPED;
+            }
+        }
+    }
+}
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EXMC_NFC_FTL_Global_Functions EXMC_NFC_FTL Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Format the flash translation layer area.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       Invalid definition of the FTL.
+ *           - LL_ERR_BUF_FULL:         Not enough good blocks for the logical pages.
+ *           - LL_ERR:                  Writing the first checkpoint failed.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   1)All the good blocks of the area are erased, the erase counts of written blocks are kept.
+ *         2)Factory bad blocks are detected by the bad block marker of the first page, and are never erased.
+ */
+int32_t EXMC_NFC_FTL_Format(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32CkptNum = 0UL;
+    stc_nfc_ftl_tag_t stcTag;
+    stc_exmc_nfc_ftl_blk_t *pstcBlk;
+    int32_t i32Ret;
+
+    i32Ret = NFC_FTL_CheckParam(pstcFtl);
+    if (LL_OK != i32Ret) {
+        return i32Ret;
+    }
+
+    pstcFtl->u32FreeBlockNum = 0UL;
+    for (i = 0UL; i < pstcFtl->u32BlockNum; i++) {
+        pstcBlk = &pstcFtl->pstcBlk[i];
+        pstcBlk->u32EraseCount = 0UL;
+        i32Ret = NFC_FTL_ReadTag(pstcFtl, i, 0UL, &stcTag);
+        if (LL_OK != i32Ret) {
+            return i32Ret;
+        }
+        if (NFC_FTL_GOOD_MARK != stcTag.u32BadMark) {
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_BAD;
+            pstcBlk->u32Seq = 0UL;
+            pstcBlk->u16ValidPages = 0U;
+            continue;
+        }
+        if ((SET == NFC_FTL_IsTagValid(&stcTag)) && (NFC_FTL_LPN_CKPT != stcTag.u32Lpn)) {
+            pstcBlk->u32EraseCount = stcTag.u32Info;
+        }
+
+        if (LL_OK != NFC_FTL_EraseBlock(pstcFtl, i)) {
+            NFC_FTL_MarkBad(pstcFtl, i);
+        } else if (u32CkptNum < NFC_FTL_CKPT_BLK_NUM) {
+            pstcFtl->au32CkptBlock[u32CkptNum] = i;
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_CKPT;
+            u32CkptNum++;
+        } else {
+            pstcBlk->u16State = EXMC_NFC_FTL_BLK_FREE;
+            pstcFtl->u32FreeBlockNum++;
+        }
+    }
+    if (RESET == NFC_FTL_IsCapacityOk(pstcFtl)) {
+        return LL_ERR_BUF_FULL;
+    }
+
+    for (i = 0UL; i < pstcFtl->u32LogicPageNum; i++) {
+        pstcFtl->pu32Map[i] = EXMC_NFC_FTL_UNMAPPED;
+    }
+    pstcFtl->u32Seq = 0UL;
+    pstcFtl->u32CkptSeq = 0UL;
+    pstcFtl->u32CkptCurr = 0UL;
+    pstcFtl->u32CkptPage = 0UL;
+    pstcFtl->u32ActiveBlock = NFC_FTL_BLK_NONE;
+    pstcFtl->u32ActivePage = pstcFtl->u32PagesPerBlock;
+    pstcFtl->u32DirtyPages = 0UL;
+
+    return EXMC_NFC_FTL_Checkpoint(pstcFtl);
+}
+
+/**
+ * @brief  Mount the flash translation layer.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       Invalid definition of the FTL.
+ *           - LL_ERR_BUF_FULL:         Not enough good blocks for the logical pages.
+ *           - LL_ERR:                  No valid checkpoint, the area needs EXMC_NFC_FTL_Format().
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   The map is loaded from the newest checkpoint, then the pages written after it are replayed from
+ *         their tags in the spare area, so a power loss only drops the page being programmed.
+ */
+int32_t EXMC_NFC_FTL_Init(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t i;
+    uint32_t u32StartPage = 0UL;
+    uint32_t u32CkptActive = NFC_FTL_BLK_NONE;
+    int32_t i32Ret;
+
+    i32Ret = NFC_FTL_CheckParam(pstcFtl);
+    if (LL_OK == i32Ret) {
+        i32Ret = NFC_FTL_ScanBlocks(pstcFtl);
+    }
+    if (LL_OK != i32Ret) {
+        return i32Ret;
+    }
+    NFC_FTL_PickCkptBlocks(pstcFtl);
+    if (RESET == NFC_FTL_IsCapacityOk(pstcFtl)) {
+        return LL_ERR_BUF_FULL;
+    }
+
+    for (i = 0UL; i < pstcFtl->u32LogicPageNum; i++) {
+        pstcFtl->pu32Map[i] = EXMC_NFC_FTL_UNMAPPED;
+    }
+    pstcFtl->u32Seq = 0UL;
+    pstcFtl->u32DirtyPages = 0UL;
+    pstcFtl->i32CkptResult = LL_OK;
+    pstcFtl->u32ActiveBlock = NFC_FTL_BLK_NONE;
+    pstcFtl->u32ActivePage = pstcFtl->u32PagesPerBlock;
+
+    pstcFtl->u32CkptSeq = NFC_FTL_FindCkpt(pstcFtl, &u32StartPage);
+    if (0UL == pstcFtl->u32CkptSeq) {
+        return LL_ERR;
+    }
+    i32Ret = NFC_FTL_LoadCkpt(pstcFtl, u32StartPage, &u32CkptActive);
+    if (LL_OK == i32Ret) {
+        i32Ret = NFC_FTL_Replay(pstcFtl, u32CkptActive);
+    }
+    if (LL_OK == i32Ret) {
+        NFC_FTL_CountValid(pstcFtl);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Read a logical page.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Lpn                  Logical page, less than u32LogicPageNum.
+ * @param  [out] pu8Data                Buffer of the page size.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred, a page never written reads as 0xFF.
+ *           - LL_ERR_INVD_PARAM:       pu8Data is NULL or u32Lpn is out of range.
+ *           - LL_ERR:                  ECC error which can not be corrected.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ */
+int32_t EXMC_NFC_FTL_Read(const stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Lpn, uint8_t *pu8Data)
+{
+    uint32_t i;
+    uint32_t u32Ppn;
+    int32_t i32Ret = LL_OK;
+
+    if ((NULL == pstcFtl) || (NULL == pu8Data) || (u32Lpn >= pstcFtl->u32LogicPageNum)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32Ppn = pstcFtl->pu32Map[u32Lpn];
+    if (EXMC_NFC_FTL_UNMAPPED == u32Ppn) {
+        for (i = 0UL; i < NFC_FTL_PAGE_SIZE; i++) {
+            pu8Data[i] = 0xFFU;
+        }
+    } else {
+        i32Ret = NFC_FTL_ReadPage(pstcFtl, u32Ppn / pstcFtl->u32PagesPerBlock, u32Ppn % pstcFtl->u32PagesPerBlock);
+        if (LL_OK == i32Ret) {
+            for (i = 0UL; i < NFC_FTL_PAGE_SIZE; i++) {
+                pu8Data[i] = pstcFtl->pu8PageBuf[i];
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Write a logical page.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @param  [in] u32Lpn                  Logical page, less than u32LogicPageNum.
+ * @param  [in] pu8Data                 Data of the page size.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       pu8Data is NULL or u32Lpn is out of range.
+ *           - LL_ERR_BUF_FULL:         No free block is left.
+ *           - LL_ERR:                  Program failed.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   1)The page goes to the next free page of the active block, the old copy is only dropped from the map.
+ *         2)Garbage is collected before the write while less than EXMC_NFC_FTL_GC_THRESHOLD blocks are free,
+ *           a block holding a page which can not be read is skipped.
+ *         3)A checkpoint is written every u32CkptInterval pages if it is not 0. Its result is kept in
+ *           i32CkptResult and does not fail the write, a failed checkpoint is tried again on the next write.
+ *         4)To write a part of a page, read the page, modify it and write it back.
+ */
+int32_t EXMC_NFC_FTL_Write(stc_exmc_nfc_ftl_t *pstcFtl, uint32_t u32Lpn, const uint8_t *pu8Data)
+{
+    uint32_t i;
+    uint32_t u32Victim;
+    int32_t i32Ret = LL_OK;
+
+    if ((NULL == pstcFtl) || (NULL == pu8Data) || (u32Lpn >= pstcFtl->u32LogicPageNum)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    while ((SET == NFC_FTL_IsGcNeeded(pstcFtl)) && (LL_OK == i32Ret)) {
+        u32Victim = NFC_FTL_PickVictim(pstcFtl);
+        if (NFC_FTL_BLK_NONE == u32Victim) {
+            break;
+        }
+        i32Ret = NFC_FTL_Collect(pstcFtl, u32Victim);
+        if ((LL_ERR == i32Ret) && (EXMC_NFC_FTL_BLK_DAMAGED == pstcFtl->pstcBlk[u32Victim].u16State)) {
+            /* Go on with the next candidate */
+            i32Ret = LL_OK;
+        }
+    }
+
+    if (LL_OK == i32Ret) {
+        for (i = 0UL; i < NFC_FTL_PAGE_SIZE; i++) {
+            pstcFtl->pu8PageBuf[i] = pu8Data[i];
+        }
+        i32Ret = NFC_FTL_Update(pstcFtl, u32Lpn);
+    }
+    if ((LL_OK == i32Ret) && (0UL != pstcFtl->u32CkptInterval) &&
+        (pstcFtl->u32DirtyPages >= pstcFtl->u32CkptInterval)) {
+        (void)EXMC_NFC_FTL_Checkpoint(pstcFtl);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Write a checkpoint of the map and the erase counts.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcFtl is NULL.
+ *           - LL_ERR_BUF_FULL:         The checkpoint block failed and no free block is left to replace it.
+ *           - LL_ERR:                  Program or erase of the checkpoint blocks failed on the retries.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   1)Checkpoints are appended to one of the two checkpoint blocks, the other block is erased only when
+ *           the current one is full, so the last complete checkpoint survives a power loss.
+ *         2)A checkpoint block failing the erase or program is marked bad, and the checkpoint is written
+ *           again from the first page of a free block.
+ *         3)The result is also kept in i32CkptResult.
+ */
+int32_t EXMC_NFC_FTL_Checkpoint(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t u32Target;
+    uint32_t u32PageNum;
+    uint32_t u32Retry = 0UL;
+    int32_t i32Ret;
+
+    if (NULL == pstcFtl) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32PageNum = NFC_FTL_CKPT_PAGE_NUM(pstcFtl);
+    pstcFtl->u32Seq++;
+    do {
+        i32Ret = LL_OK;
+        u32Target = pstcFtl->u32CkptCurr;
+        if ((pstcFtl->u32CkptPage + u32PageNum) > pstcFtl->u32PagesPerBlock) {
+            u32Target ^= 1UL;
+            i32Ret = NFC_FTL_EraseBlock(pstcFtl, pstcFtl->au32CkptBlock[u32Target]);
+            if (LL_OK == i32Ret) {
+                pstcFtl->u32CkptCurr = u32Target;
+                pstcFtl->u32CkptPage = 0UL;
+            }
+        }
+        if (LL_OK == i32Ret) {
+            i32Ret = NFC_FTL_ProgramCkpt(pstcFtl, u32PageNum);
+        }
+
+        if (LL_ERR == i32Ret) {
+            if (LL_OK == NFC_FTL_ReplaceCkptBlock(pstcFtl, u32Target)) {
+                pstcFtl->u32CkptCurr = u32Target;
+                pstcFtl->u32CkptPage = 0UL;
+                u32Retry++;
+            } else {
+                if (u32Target == pstcFtl->u32CkptCurr) {
+                    /* Move to the other block on the next checkpoint */
+                    pstcFtl->u32CkptPage = pstcFtl->u32PagesPerBlock;
+                }
+                i32Ret = LL_ERR_BUF_FULL;
+            }
+        }
+    } while ((LL_ERR == i32Ret) && (u32Retry < NFC_FTL_PGM_RETRY));
+
+    if (LL_OK == i32Ret) {
+        pstcFtl->u32CkptSeq = pstcFtl->u32Seq;
+        pstcFtl->u32DirtyPages = 0UL;
+    }
+    pstcFtl->i32CkptResult = i32Ret;
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Collect one block in the background.
+ * @param  [in] pstcFtl                 Pointer to a @ref stc_exmc_nfc_ftl_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   One block is collected.
+ *           - LL_ERR_INVD_PARAM:       pstcFtl is NULL.
+ *           - LL_ERR_NOT_RDY:          Nothing to collect.
+ *           - LL_ERR_BUF_FULL:         No free block is left.
+ *           - LL_ERR:                  A valid page can not be programmed, or can not be read or found by its
+ *                                      tag. The block is skipped by the next steps.
+ *           - LL_ERR_TIMEOUT:          NFC operation timeout.
+ * @note   The block with the least valid pages is collected while less than EXMC_NFC_FTL_GC_THRESHOLD
+ *         blocks are free, as EXMC_NFC_FTL_Write() does. Otherwise the block with the least erases is moved
+ *         if the erase counts spread more than EXMC_NFC_FTL_WEAR_LIMIT, so that static data does not pin the
+ *         young blocks.
+ */
+int32_t EXMC_NFC_FTL_GcStep(stc_exmc_nfc_ftl_t *pstcFtl)
+{
+    uint32_t u32Blk;
+
+    if (NULL == pstcFtl) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (SET == NFC_FTL_IsGcNeeded(pstcFtl)) {
+        u32Blk = NFC_FTL_PickVictim(pstcFtl);
+    } else {
+        u32Blk = NFC_FTL_PickCold(pstcFtl);
+    }
+    if (NFC_FTL_BLK_NONE == u32Blk) {
+        return LL_ERR_NOT_RDY;
+    }
+
+    return NFC_FTL_Collect(pstcFtl, u32Blk);
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_NFC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -7,6 +7,8 @@
    Date             Author          Notes
    2024-09-13       CDT             First version
    2024-11-08       CDT             Fix QSPI_ClearStatus()
+   2026-10-18       CDT             Add memory mapped read profiler with read setting selection
+   2026-10-18       CDT             Add flash program/erase service with DMA page writes
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -24,6 +26,9 @@
  ******************************************************************************/
 #include "hc32_ll_qspi.h"
 #include "hc32_ll_utility.h"
+#if (LL_DMA_ENABLE == DDL_ON)
+#include "hc32_ll_dma.h"
+#endif
 
 /**
  * @addtogroup LL_Driver
@@ -146,6 +151,28 @@
 /* QSPI reset timeout */
 #define QSPI_RMU_TIMEOUT                (100UL)
 
+/* Read profile */
+#define QSPI_PROFILE_CR_MASK            (QSPI_CR_MDSEL  | QSPI_CR_PFE       | QSPI_CR_PFSAE)
+#define QSPI_PROFILE_RAND_SEED          (0x5A5A5A5AUL)
+#define QSPI_PROFILE_RAND_NEXT(x)       (((x) * 1664525UL) + 1013904223UL)
+
+/* Flash program/erase service */
+#ifndef __QSPI_FUNC
+#define __QSPI_FUNC
+#endif
+
+#define QSPI_FLASH_IDLE                 (0U)    /* No operation is running                      */
+#define QSPI_FLASH_DATA                 (1U)    /* DMA is sending the page data                 */
+#define QSPI_FLASH_WIP                  (2U)    /* The flash is programming or erasing          */
+
+#define QSPI_FLASH_PAGE_MAX             (1024UL)
+#define QSPI_FLASH_DMA_CH_MAX           (7U)
+#if (LL_DMA_ENABLE == DDL_ON)
+#define IS_QSPI_FLASH_DMA(dma, ch)      (((dma) == NULL) || ((ch) <= QSPI_FLASH_DMA_CH_MAX))
+#else
+#define IS_QSPI_FLASH_DMA(dma, ch)      ((dma) == NULL)
+#endif
+
 /**
  * @}
  */
@@ -169,6 +196,205 @@
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
+/**
+ * @defgroup QSPI_Local_Functions QSPI Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Compare the memory mapped data with the pattern.
+ * @param  [in] u32Addr                 Memory mapped address of the pattern, word aligned.
+ * @param  [in] au8Pattern              The pattern.
+ * @param  [in] u32Len                  Length of the pattern in bytes, a multiple of 4.
+ * @retval int32_t:
+ *           - LL_OK:                   The data matches the pattern.
+ *           - LL_ERR:                  The data does not match the pattern.
+ */
+static int32_t QSPI_ProfileVerify(uint32_t u32Addr, const uint8_t au8Pattern[], uint32_t u32Len)
+{
+    uint32_t i;
+    uint32_t u32Expect;
+    const __IO uint32_t *pu32Rom = (const __IO uint32_t *)u32Addr;
+
+    for (i = 0UL; i < u32Len; i += 4UL) {
+        u32Expect = (uint32_t)au8Pattern[i] | ((uint32_t)au8Pattern[i + 1UL] << 8U) |
+                    ((uint32_t)au8Pattern[i + 2UL] << 16U) | ((uint32_t)au8Pattern[i + 3UL] << 24U);
+        if (pu32Rom[i / 4UL] != u32Expect) {
+            return LL_ERR;
+        }
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Measure the sequential and random word reads of the memory mapped area.
+ * @param  [in] u32Addr                 Memory mapped address, word aligned.
+ * @param  [in] u32Words                Number of words.
+ * @param  [out] pstcProfile            Pointer to a @ref stc_qspi_read_profile_t structure, the cycles are filled in.
+ * @retval None
+ */
+static void QSPI_ProfileMeasure(uint32_t u32Addr, uint32_t u32Words, stc_qspi_read_profile_t *pstcProfile)
+{
+    uint32_t i;
+    uint32_t u32Start;
+    uint32_t u32Rand = QSPI_PROFILE_RAND_SEED;
+    __IO uint32_t u32Data;
+    const __IO uint32_t *pu32Rom = (const __IO uint32_t *)u32Addr;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        u32Data = pu32Rom[i];
+    }
+    pstcProfile->u32SeqCycles = DWT->CYCCNT - u32Start;
+
+    u32Start = DWT->CYCCNT;
+    for (i = 0UL; i < u32Words; i++) {
+        u32Rand = QSPI_PROFILE_RAND_NEXT(u32Rand);
+        u32Data = pu32Rom[(u32Rand >> 8U) % u32Words];
+    }
+    pstcProfile->u32RandCycles = DWT->CYCCNT - u32Start;
+    (void)u32Data;
+}
+
+/**
+ * @brief  Send an instruction without address and data.
+ * @param  [in] u8Instr                 Instruction code.
+ * @retval None
+ */
+static __QSPI_FUNC void QSPI_FlashInstr(uint8_t u8Instr)
+{
+    SET_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+    WRITE_REG32(CM_QSPI->DCOM, u8Instr);
+    CLR_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+}
+
+/**
+ * @brief  Send an instruction and the address, QSSN is kept low for the data stage.
+ * @param  [in] u8Instr                 Instruction code.
+ * @param  [in] u32Addr                 Flash address, QSPI_FLASH_NO_ADDR for none.
+ * @retval None
+ * @note   The address width follows the setting of QSPI_Init().
+ */
+static __QSPI_FUNC void QSPI_FlashInstrAddr(uint8_t u8Instr, uint32_t u32Addr)
+{
+    uint32_t u32Shift;
+
+    SET_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+    WRITE_REG32(CM_QSPI->DCOM, u8Instr);
+    if (QSPI_FLASH_NO_ADDR != u32Addr) {
+        u32Shift = (READ_REG32_BIT(CM_QSPI->FCR, QSPI_FCR_AWSL) >> QSPI_FCR_AWSL_POS) * 8UL;
+        do {
+            WRITE_REG32(CM_QSPI->DCOM, (uint8_t)(u32Addr >> u32Shift));
+            u32Shift -= 8UL;
+        } while (u32Shift <= 24UL);
+    }
+}
+
+/**
+ * @brief  Read a register of the flash by an instruction without address.
+ * @param  [in] u8Instr                 Instruction code.
+ * @retval The register value.
+ */
+static __QSPI_FUNC uint8_t QSPI_FlashReadReg(uint8_t u8Instr)
+{
+    uint8_t u8Value;
+
+    SET_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+    WRITE_REG32(CM_QSPI->DCOM, u8Instr);
+    u8Value = (uint8_t)READ_REG32(CM_QSPI->DCOM);
+    CLR_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+
+    return u8Value;
+}
+
+/**
+ * @brief  Leave XIP mode before the direct communication.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @retval None
+ */
+static __QSPI_FUNC void QSPI_FlashExitXip(stc_qspi_flash_t *pstcFlash)
+{
+    __IO uint8_t u8Dummy;
+
+    pstcFlash->u8XipOn = 0U;
+    if (0UL != READ_REG32_BIT(CM_QSPI->CR, QSPI_CR_XIPE)) {
+        pstcFlash->u8XipOn = 1U;
+        QSPI_XipModeCmd(QSPI_FLASH_XIP_EXIT_CODE, DISABLE);
+        /* The exit mode code is sent by the next read */
+        u8Dummy = *(__IO uint8_t *)QSPI_ROM_BASE;
+        (void)u8Dummy;
+    }
+}
+
+/**
+ * @brief  Re-enter XIP mode if it was on.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @retval None
+ */
+static __QSPI_FUNC void QSPI_FlashEnterXip(const stc_qspi_flash_t *pstcFlash)
+{
+    __IO uint8_t u8Dummy;
+
+    if (0U != pstcFlash->u8XipOn) {
+        QSPI_XipModeCmd(pstcFlash->u8XipModeCode, ENABLE);
+        /* The mode code is sent by the next read */
+        u8Dummy = *(__IO uint8_t *)QSPI_ROM_BASE;
+        (void)u8Dummy;
+    }
+}
+
+/**
+ * @brief  Program the next page, at most to the page boundary.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @retval None
+ * @note   Writing the direct communication register stalls the bus until the previous byte is sent, so the DMA
+ *         moves the page without a trigger source.
+ */
+static __QSPI_FUNC void QSPI_FlashStartPage(stc_qspi_flash_t *pstcFlash)
+{
+    uint32_t i;
+    const uint32_t u32Bytes = LL_MIN(pstcFlash->u32PageSize - (pstcFlash->u32Addr & (pstcFlash->u32PageSize - 1UL)),
+                                     pstcFlash->u32Remain);
+#if (LL_DMA_ENABLE == DDL_ON)
+    stc_dma_init_t stcDmaInit;
+#endif
+
+    QSPI_FlashInstr(QSPI_FLASH_INSTR_WRITE_ENABLE);
+    QSPI_FlashInstrAddr(pstcFlash->u8PageProgramInstr, pstcFlash->u32Addr);
+    if (NULL != pstcFlash->DMAx) {
+#if (LL_DMA_ENABLE == DDL_ON)
+        (void)DMA_StructInit(&stcDmaInit);
+        stcDmaInit.u32IntEn = DMA_INT_DISABLE;
+        stcDmaInit.u32SrcAddr = (uint32_t)pstcFlash->pu8Data;
+        stcDmaInit.u32DestAddr = (uint32_t)(&CM_QSPI->DCOM);
+        stcDmaInit.u32DataWidth = DMA_DATAWIDTH_8BIT;
+        stcDmaInit.u32BlockSize = u32Bytes;
+        stcDmaInit.u32TransCount = 1UL;
+        stcDmaInit.u32SrcAddrInc = DMA_SRC_ADDR_INC;
+        stcDmaInit.u32DestAddrInc = DMA_DEST_ADDR_FIX;
+        (void)DMA_Init(pstcFlash->DMAx, pstcFlash->u8DmaCh, &stcDmaInit);
+        DMA_ClearTransCompleteStatus(pstcFlash->DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << pstcFlash->u8DmaCh);
+        (void)DMA_ChCmd(pstcFlash->DMAx, pstcFlash->u8DmaCh, ENABLE);
+        DMA_MxChSWTrigger(pstcFlash->DMAx, (uint8_t)(1U << pstcFlash->u8DmaCh));
+#endif
+        pstcFlash->u8State = QSPI_FLASH_DATA;
+    } else {
+        for (i = 0UL; i < u32Bytes; i++) {
+            WRITE_REG32(CM_QSPI->DCOM, pstcFlash->pu8Data[i]);
+        }
+        CLR_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+        pstcFlash->u8State = QSPI_FLASH_WIP;
+    }
+    pstcFlash->u32Addr += u32Bytes;
+    pstcFlash->pu8Data += u32Bytes;
+    pstcFlash->u32Remain -= u32Bytes;
+}
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup QSPI_Global_Functions QSPI Global Functions
  * @{
@@ -384,6 +610,294 @@ void QSPI_XipModeCmd(uint8_t u8ModeCode, en_functional_state_t enNewState)
     }
 }
 
+/**
+ * @brief  Profile the memory mapped read settings and select the fastest one that reads the pattern correctly.
+ * @param  [in] u32Addr                 Memory mapped address of a known pattern in the external flash, word aligned.
+ * @param  [in] au8Pattern              The pattern expected at u32Addr.
+ * @param  [in] u32Len                  Length of the pattern in bytes, a non-zero multiple of 4.
+ * @param  [in,out] pstcProfile         Pointer to an array of @ref stc_qspi_read_profile_t, the settings are set by
+ *                                      the user, the result and the cycles are filled in.
+ * @param  [in] u32Num                  Number of settings.
+ * @param  [out] pu32Best               Index of the selected setting, can be NULL.
+ * @retval int32_t:
+ *           - LL_OK:                   A setting is selected and applied.
+ *           - LL_ERR:                  No setting reads the pattern correctly, the original setting is restored.
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter.
+ * @note   1)Each setting must read the pattern correctly QSPI_PROFILE_VERIFY_LOOP times, then its sequential and
+ *           random read cycles are measured by the DWT cycle counter. The setting with the least total cycles
+ *           is selected.
+ *         2)Do not run code from the QSPI area and keep XIP mode off while profiling, disable the interrupts
+ *           for stable results.
+ *         3)The flash must accept every listed read instruction, e.g. the quad enable bit is set for quad modes,
+ *           and QSPI_CustomReadConfig() is called for custom modes. The dummy cycles must cover the flash
+ *           requirement at the clock division in use, a setting with too few dummy cycles fails the pattern.
+ */
+int32_t QSPI_ReadProfile(uint32_t u32Addr, const uint8_t au8Pattern[], uint32_t u32Len,
+                         stc_qspi_read_profile_t *pstcProfile, uint32_t u32Num, uint32_t *pu32Best)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t u32Best = u32Num;
+    uint32_t u32Cycles;
+    uint32_t u32BestCycles = 0xFFFFFFFFUL;
+    const uint32_t u32Cr = READ_REG32_BIT(CM_QSPI->CR, QSPI_PROFILE_CR_MASK);
+    const uint32_t u32Fcr = READ_REG32_BIT(CM_QSPI->FCR, QSPI_FCR_DMCYCN);
+
+    if ((NULL == au8Pattern) || (NULL == pstcProfile) || (0UL == u32Num) || (0UL == u32Len) ||
+        (0UL != (u32Len & 3UL)) || (!IS_ADDR_ALIGN_WORD(u32Addr)) ||
+        (u32Addr < QSPI_ROM_BASE) || ((QSPI_ROM_END - u32Addr) < (u32Len - 1UL))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    for (i = 0UL; i < u32Num; i++) {
+        if ((!IS_QSPI_READ_MD(pstcProfile[i].u32ReadMode)) || (!IS_QSPI_DUMMY_CYCLE(pstcProfile[i].u32DummyCycle)) ||
+            (!IS_QSPI_PREFETCH_MD(pstcProfile[i].u32PrefetchMode))) {
+            return LL_ERR_INVD_PARAM;
+        }
+    }
+
+    SET_REG32_BIT(CoreDebug->DEMCR, CoreDebug_DEMCR_TRCENA_Msk);
+    SET_REG32_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk);
+    for (i = 0UL; i < u32Num; i++) {
+        MODIFY_REG32(CM_QSPI->CR, QSPI_PROFILE_CR_MASK, pstcProfile[i].u32ReadMode | pstcProfile[i].u32PrefetchMode);
+        MODIFY_REG32(CM_QSPI->FCR, QSPI_FCR_DMCYCN, pstcProfile[i].u32DummyCycle);
+        pstcProfile[i].i32Result = LL_OK;
+        pstcProfile[i].u32SeqCycles = 0UL;
+        pstcProfile[i].u32RandCycles = 0UL;
+        for (j = 0UL; (j < QSPI_PROFILE_VERIFY_LOOP) && (LL_OK == pstcProfile[i].i32Result); j++) {
+            pstcProfile[i].i32Result = QSPI_ProfileVerify(u32Addr, au8Pattern, u32Len);
+        }
+        if (LL_OK == pstcProfile[i].i32Result) {
+            QSPI_ProfileMeasure(u32Addr, u32Len / 4UL, &pstcProfile[i]);
+            u32Cycles = pstcProfile[i].u32SeqCycles + pstcProfile[i].u32RandCycles;
+            if (u32Cycles < u32BestCycles) {
+                u32BestCycles = u32Cycles;
+                u32Best = i;
+            }
+        }
+    }
+
+    if (u32Best < u32Num) {
+        MODIFY_REG32(CM_QSPI->CR, QSPI_PROFILE_CR_MASK,
+                     pstcProfile[u32Best].u32ReadMode | pstcProfile[u32Best].u32PrefetchMode);
+        MODIFY_REG32(CM_QSPI->FCR, QSPI_FCR_DMCYCN, pstcProfile[u32Best].u32DummyCycle);
+    } else {
+        MODIFY_REG32(CM_QSPI->CR, QSPI_PROFILE_CR_MASK, u32Cr);
+        MODIFY_REG32(CM_QSPI->FCR, QSPI_FCR_DMCYCN, u32Fcr);
+    }
+    if (NULL != pu32Best) {
+        *pu32Best = u32Best;
+    }
+
+    return (u32Best < u32Num) ? LL_OK : LL_ERR;
+}
+
+/**
+ * @brief  Set the default value of each member of a QSPI flash service structure.
+ * @param  [out] pstcFlash              Pointer to a @ref stc_qspi_flash_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcFlash is NULL.
+ * @note   The page data is written by CPU and the page size is 256 bytes by default.
+ */
+int32_t QSPI_FlashStructInit(stc_qspi_flash_t *pstcFlash)
+{
+    if (NULL == pstcFlash) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcFlash->DMAx = NULL;
+    pstcFlash->u8DmaCh = 0U;
+    pstcFlash->u8PageProgramInstr = QSPI_FLASH_INSTR_PAGE_PROGRAM;
+    pstcFlash->u8XipModeCode = 0U;
+    pstcFlash->u8FailStatusInstr = QSPI_FLASH_INSTR_NONE;
+    pstcFlash->u8FailStatusMask = 0U;
+    pstcFlash->u32PageSize = 256UL;
+
+    return QSPI_FlashInit(pstcFlash);
+}
+
+/**
+ * @brief  Initialize a QSPI flash service structure.
+ * @param  [in,out] pstcFlash           Pointer to a @ref stc_qspi_flash_t structure with the members up to
+ *                                      u32PageSize set, the others are cleared here.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcFlash is NULL, or the page size or the DMA channel is invalid.
+ * @note   Call it before the first QSPI_FlashProgramStart() or QSPI_FlashEraseStart().
+ */
+int32_t QSPI_FlashInit(stc_qspi_flash_t *pstcFlash)
+{
+    if ((NULL == pstcFlash) || (0UL == pstcFlash->u32PageSize) || (pstcFlash->u32PageSize > QSPI_FLASH_PAGE_MAX) ||
+        (0UL != (pstcFlash->u32PageSize & (pstcFlash->u32PageSize - 1UL))) ||
+        (!IS_QSPI_FLASH_DMA(pstcFlash->DMAx, pstcFlash->u8DmaCh))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcFlash->u32Addr = 0UL;
+    pstcFlash->pu8Data = NULL;
+    pstcFlash->u32Remain = 0UL;
+    pstcFlash->u8State = QSPI_FLASH_IDLE;
+    pstcFlash->u8XipOn = 0U;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Start programming the external flash.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @param  [in] u32Addr                 Flash address.
+ * @param  [in] au8Data                 Data to be programmed, kept until the operation is done.
+ * @param  [in] u32Len                  Length of the data in bytes.
+ * @retval int32_t:
+ *           - LL_OK:                   The first page is started, call QSPI_FlashProcess() until it returns LL_OK.
+ *           - LL_ERR_BUSY:             An operation is running.
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter.
+ * @note   1)XIP mode is left here and re-entered when the operation is done. The QSPI area can not be read
+ *           until then.
+ *         2)The area must be erased. Pages are split at the page boundaries of the flash.
+ *         3)With DMA, enable the DMA unit by DMA_Cmd() first. The transfer complete flag is polled, the channel
+ *           interrupt is disabled.
+ *         4)The service functions are located by __QSPI_FUNC, which is empty by default. Define it as __RAM_FUNC
+ *           in hc32f4xx_conf.h if the code is executed from the QSPI flash, QSPI_XipModeCmd() and the DMA
+ *           functions called here must not be in the QSPI flash either.
+ */
+__NOINLINE __QSPI_FUNC int32_t QSPI_FlashProgramStart(stc_qspi_flash_t *pstcFlash, uint32_t u32Addr,
+                                                      const uint8_t au8Data[], uint32_t u32Len)
+{
+    if ((NULL == pstcFlash) || (NULL == au8Data) || (0UL == u32Len) || (0UL == pstcFlash->u32PageSize) ||
+        (pstcFlash->u32PageSize > QSPI_FLASH_PAGE_MAX) ||
+        (0UL != (pstcFlash->u32PageSize & (pstcFlash->u32PageSize - 1UL))) ||
+        (!IS_QSPI_FLASH_DMA(pstcFlash->DMAx, pstcFlash->u8DmaCh))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (QSPI_FLASH_IDLE != pstcFlash->u8State) {
+        return LL_ERR_BUSY;
+    }
+
+    pstcFlash->u32Addr = u32Addr;
+    pstcFlash->pu8Data = au8Data;
+    pstcFlash->u32Remain = u32Len;
+    QSPI_FlashExitXip(pstcFlash);
+    QSPI_FlashStartPage(pstcFlash);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Start erasing the external flash.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @param  [in] u8Instr                 Erase instruction, e.g. QSPI_FLASH_INSTR_SECTOR_ERASE.
+ * @param  [in] u32Addr                 Flash address in the area to be erased, QSPI_FLASH_NO_ADDR for chip erase.
+ * @retval int32_t:
+ *           - LL_OK:                   The erase is started, call QSPI_FlashProcess() until it returns LL_OK.
+ *           - LL_ERR_BUSY:             An operation is running.
+ *           - LL_ERR_INVD_PARAM:       pstcFlash is NULL.
+ * @note   XIP mode is left here and re-entered when the operation is done.
+ */
+__NOINLINE __QSPI_FUNC int32_t QSPI_FlashEraseStart(stc_qspi_flash_t *pstcFlash, uint8_t u8Instr, uint32_t u32Addr)
+{
+    if (NULL == pstcFlash) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (QSPI_FLASH_IDLE != pstcFlash->u8State) {
+        return LL_ERR_BUSY;
+    }
+
+    pstcFlash->u32Remain = 0UL;
+    QSPI_FlashExitXip(pstcFlash);
+    QSPI_FlashInstr(QSPI_FLASH_INSTR_WRITE_ENABLE);
+    QSPI_FlashInstrAddr(u8Instr, u32Addr);
+    CLR_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+    pstcFlash->u8State = QSPI_FLASH_WIP;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Advance the running program or erase operation.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No operation is running, XIP mode is restored.
+ *           - LL_ERR_BUSY:             The operation is running.
+ *           - LL_ERR:                  The flash reports a program or erase failure, the operation is stopped
+ *                                      and XIP mode is restored.
+ *           - LL_ERR_INVD_PARAM:       pstcFlash is NULL.
+ * @note   1)Call it from the main loop or a timer, the caller runs on while the flash is busy. The status register
+ *           is read once per call, the next page is started as soon as the previous one is done.
+ *         2)A page or erase fails if WEL is still set when WIP is cleared, or if a flag of u8FailStatusMask is
+ *           set in the register read by u8FailStatusInstr. The fail flags are not cleared here.
+ */
+__NOINLINE __QSPI_FUNC int32_t QSPI_FlashProcess(stc_qspi_flash_t *pstcFlash)
+{
+    uint8_t u8Status;
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcFlash) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (QSPI_FLASH_DATA == pstcFlash->u8State) {
+#if (LL_DMA_ENABLE == DDL_ON)
+        if (SET != DMA_GetTransCompleteStatus(pstcFlash->DMAx, DMA_FLAG_TC_CH0 << pstcFlash->u8DmaCh)) {
+            return LL_ERR_BUSY;
+        }
+        DMA_ClearTransCompleteStatus(pstcFlash->DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << pstcFlash->u8DmaCh);
+        (void)DMA_ChCmd(pstcFlash->DMAx, pstcFlash->u8DmaCh, DISABLE);
+#endif
+        /* Release QSSN to start programming */
+        CLR_REG32_BIT(CM_QSPI->CR, QSPI_CR_DCOME);
+        pstcFlash->u8State = QSPI_FLASH_WIP;
+    } else if (QSPI_FLASH_WIP == pstcFlash->u8State) {
+        u8Status = QSPI_FlashReadReg(QSPI_FLASH_INSTR_READ_STATUS);
+        if (0U == (u8Status & QSPI_FLASH_STATUS_WIP)) {
+            /* WEL is left set if the flash ignored the operation, e.g. in a protected area */
+            if ((0U != (u8Status & QSPI_FLASH_STATUS_WEL)) ||
+                ((QSPI_FLASH_INSTR_NONE != pstcFlash->u8FailStatusInstr) &&
+                 (0U != (QSPI_FlashReadReg(pstcFlash->u8FailStatusInstr) & pstcFlash->u8FailStatusMask)))) {
+                QSPI_FlashInstr(QSPI_FLASH_INSTR_WRITE_DISABLE);
+                pstcFlash->u32Remain = 0UL;
+                i32Ret = LL_ERR;
+            }
+            if (0UL != pstcFlash->u32Remain) {
+                QSPI_FlashStartPage(pstcFlash);
+            } else {
+                QSPI_FlashEnterXip(pstcFlash);
+                pstcFlash->u8State = QSPI_FLASH_IDLE;
+            }
+        }
+    } else {
+        /* rsvd */
+    }
+
+    if ((LL_OK == i32Ret) && (QSPI_FLASH_IDLE != pstcFlash->u8State)) {
+        i32Ret = LL_ERR_BUSY;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Wait for the running program or erase operation.
+ * @param  [in] pstcFlash               Pointer to a @ref stc_qspi_flash_t structure.
+ * @param  [in] u32Timeout              Maximum calls of QSPI_FlashProcess().
+ * @retval int32_t:
+ *           - LL_OK:                   No operation is running, XIP mode is restored.
+ *           - LL_ERR:                  The flash reports a program or erase failure.
+ *           - LL_ERR_TIMEOUT:          The operation is still running.
+ *           - LL_ERR_INVD_PARAM:       pstcFlash is NULL.
+ */
+__NOINLINE __QSPI_FUNC int32_t QSPI_FlashWaitDone(stc_qspi_flash_t *pstcFlash, uint32_t u32Timeout)
+{
+    uint32_t u32Count = 0UL;
+    int32_t i32Ret;
+
+    do {
+        i32Ret = QSPI_FlashProcess(pstcFlash);
+        u32Count++;
+    } while ((LL_ERR_BUSY == i32Ret) && (u32Count < u32Timeout));
+
+    return (LL_ERR_BUSY == i32Ret) ? LL_ERR_TIMEOUT : i32Ret;
+}
+
 /**
  * @brief  Enter direct communication mode.
  * @param  None
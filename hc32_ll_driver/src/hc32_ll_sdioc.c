@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add DMA multi-block transfer with scatter-gather descriptor chain
+   2026-10-18       CDT             Add word-wide FIFO copy for aligned buffers
+   2026-10-18       CDT             Add SD card bus width and high speed bring-up
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -70,6 +73,22 @@
 
 /* Command send and response timeout(ms) */
 #define SDMMC_CMD_TIMEOUT                       (5000UL)
+/* SD card bus speed bring-up */
+#define SDMMC_SCR_SIZE                          (8U)
+#define SDMMC_SCR_PHY_SPEC_VER_MASK             (0x0F000000UL)
+#define SDMMC_ACMD6_BUS_WIDTH_4BIT              (0x00000002UL)
+#define SDMMC_SWITCH_STATUS_SIZE                (64U)
+#define SDMMC_CMD6_CHECK_HIGH_SPEED             (0x00FFFFF1UL)
+#define SDMMC_CMD6_SET_HIGH_SPEED               (0x80FFFFF1UL)
+#define SDMMC_CMD6_SET_DEFAULT_SPEED            (0x80FFFFF0UL)
+/* Switch status bit 401 and bits 379:376 in the words read from the FIFO */
+#define SDMMC_SWITCH_HIGH_SPEED_SUPPORT         (0x00000200UL)
+#define SDMMC_SWITCH_GROUP1_RESULT              (0x0000000FUL)
+#define SDMMC_SWITCH_HIGH_SPEED_DONE            (0x00000001UL)
+#define SDMMC_SWITCH_DEFAULT_SPEED_DONE         (0x00000000UL)
+#define SDMMC_TEST_BLOCK_SIZE                   (512U)
+#define SDMMC_DATA_ERR_FLAG                     (SDIOC_INT_FLAG_DEBE | SDIOC_INT_FLAG_DCE | SDIOC_INT_FLAG_DTOE)
+
 /* Max erase Timeout 60s */
 #define SDMMC_MAX_ERASE_TIMEOUT                 (60000UL)
 /* SDIOC software reset timeout(ms) */
@@ -85,6 +104,15 @@
 #define SDIOC_BUF_ADDR(__UNIT__)                (__IO uint32_t*)((uint32_t)(&((__UNIT__)->BUF0)))
 #define SDIOC_RESP_ADDR(__UNIT__, __RESP__)     (__IO uint32_t*)((uint32_t)(&((__UNIT__)->RESP0)) + (__RESP__))
 
+/* Words moved by one round of the aligned buffer copy */
+#define SDIOC_BUF_UNROLL_WORDS                  (8U)
+
+/* Largest block size moved by one DMA request */
+#define SDIOC_DMA_BLOCK_SIZE_MAX                (512U)
+/* Data errors that end a DMA multi-block transfer */
+#define SDIOC_DMA_DATA_ERR_FLAG                 (SDIOC_INT_FLAG_ACE | SDIOC_INT_FLAG_DEBE | SDIOC_INT_FLAG_DCE | \
+                                                 SDIOC_INT_FLAG_DTOE)
+
 /**
  * @defgroup SDIOC_Check_Parameters_Validity SDIOC Check Parameters Validity
  * @{
@@ -539,6 +567,156 @@ static int32_t SDMMC_GetCmdResp7(CM_SDIOC_TypeDef *SDIOCx, uint32_t *pu32ErrStat
                                        SDIOC_INT_FLAG_CCE | SDIOC_INT_FLAG_CTOE), SDMMC_CMD_TIMEOUT, pu32ErrStatus);
 }
 
+/**
+ * @brief  Configure and wait for a single block read, keeping its first words.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in] u16BlockSize            Data block size
+ * @param  [out] au32Data               Buffer of the first words of the block
+ * @param  [in] u32Words                Number of the words kept in au32Data
+ * @param  [out] pu32ErrStatus          Pointer to the error state value
+ * @retval int32_t:
+ *           - LL_OK: The block is received
+ *           - LL_ERR: Refer to pu32ErrStatus for the reason of error
+ *           - LL_ERR_TIMEOUT: Wait timeout
+ * @note   The data is configured by SDMMC_ConfigReadBlock() before the command is sent.
+ */
+static int32_t SDMMC_ReadBlock(CM_SDIOC_TypeDef *SDIOCx, uint16_t u16BlockSize, uint32_t au32Data[],
+                               uint32_t u32Words, uint32_t *pu32ErrStatus)
+{
+    __IO uint32_t u32Count;
+    int32_t i32Ret = LL_OK;
+    uint32_t u32Temp;
+    uint32_t i;
+
+    u32Count = SDMMC_CMD_TIMEOUT * (HCLK_VALUE / 20000UL);
+    while (RESET == SDIOC_GetIntStatus(SDIOCx, SDIOC_INT_FLAG_TC | SDMMC_DATA_ERR_FLAG)) {
+        if (SET == SDIOC_GetIntStatus(SDIOCx, SDIOC_INT_FLAG_BRR)) {
+            SDIOC_ClearIntStatus(SDIOCx, SDIOC_INT_FLAG_BRR);
+            for (i = 0UL; i < ((uint32_t)u16BlockSize / 4UL); i++) {
+                u32Temp = READ_REG32(*SDIOC_BUF_ADDR(SDIOCx));
+                if (i < u32Words) {
+                    au32Data[i] = u32Temp;
+                }
+            }
+        }
+        if (0UL == u32Count) {
+            i32Ret = LL_ERR_TIMEOUT;
+            break;
+        }
+        u32Count--;
+    }
+
+    if (LL_OK == i32Ret) {
+        *pu32ErrStatus = SDMMC_ERR_NONE;
+        if (SET == SDIOC_GetIntStatus(SDIOCx, SDIOC_INT_FLAG_DTOE)) {
+            *pu32ErrStatus = SDMMC_ERR_DATA_TIMEOUT;
+        } else if (SET == SDIOC_GetIntStatus(SDIOCx, SDIOC_INT_FLAG_DCE)) {
+            *pu32ErrStatus = SDMMC_ERR_DATA_CRC_FAIL;
+        } else if (SET == SDIOC_GetIntStatus(SDIOCx, SDIOC_INT_FLAG_DEBE)) {
+            *pu32ErrStatus = SDMMC_ERR_DATA_STOP_BIT;
+        } else {
+            /* rsvd */
+        }
+        if (SDMMC_ERR_NONE != *pu32ErrStatus) {
+            i32Ret = LL_ERR;
+        }
+    }
+    SDIOC_ClearIntStatus(SDIOCx, SDIOC_INT_FLAG_TC | SDIOC_INT_FLAG_BRR | SDMMC_DATA_ERR_FLAG);
+    if (LL_OK != i32Ret) {
+        (void)SDIOC_SWReset(SDIOCx, SDIOC_SW_RST_DATA_LINE);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Configure the data of a single block read.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in] u16BlockSize            Data block size
+ * @retval None
+ */
+static void SDMMC_ConfigReadBlock(CM_SDIOC_TypeDef *SDIOCx, uint16_t u16BlockSize)
+{
+    stc_sdioc_data_config_t stcDataConfig;
+
+    (void)SDIOC_DataStructInit(&stcDataConfig);
+    stcDataConfig.u16BlockSize   = u16BlockSize;
+    stcDataConfig.u16BlockCount  = 1U;
+    stcDataConfig.u16TransDir    = SDIOC_TRANS_DIR_TO_HOST;
+    stcDataConfig.u16DataTimeout = SDIOC_DATA_TIMEOUT_CLK_2E27;
+    (void)SDIOC_ConfigData(SDIOCx, &stcDataConfig);
+}
+
+/**
+ * @brief  Set the host bus clock of the speed mode.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in,out] pstcBusConfig       Pointer to a @ref stc_sdmmc_bus_config_t structure, the speed
+ *                                      mode is used and the clock division is filled in.
+ * @retval int32_t:
+ *           - LL_OK: The clock is set
+ *           - LL_ERR: No clock division fits
+ */
+static int32_t SDMMC_SetHostClock(CM_SDIOC_TypeDef *SDIOCx, stc_sdmmc_bus_config_t *pstcBusConfig)
+{
+    int32_t i32Ret;
+    uint32_t u32ClockFreq = SDIOC_OUTPUT_CLK_FREQ_25M;
+
+    if (SDIOC_SPEED_MD_HIGH == pstcBusConfig->u8SpeedMode) {
+        u32ClockFreq = SDIOC_OUTPUT_CLK_FREQ_50M;
+    }
+    i32Ret = SDIOC_GetOptimumClockDiv(u32ClockFreq, &pstcBusConfig->u16ClockDiv);
+    if (LL_OK == i32Ret) {
+        SDIOC_ClockCmd(SDIOCx, DISABLE);
+        SDIOC_SetSpeedMode(SDIOCx, pstcBusConfig->u8SpeedMode);
+        SDIOC_SetClockDiv(SDIOCx, pstcBusConfig->u16ClockDiv);
+        SDIOC_ClockCmd(SDIOCx, ENABLE);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Set the bus clock and verify it with a single block read.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in] u32TestAddr             Address of the block read
+ * @param  [in,out] pstcBusConfig       Pointer to a @ref stc_sdmmc_bus_config_t structure, the speed
+ *                                      mode is used and the clock division is filled in.
+ * @param  [out] pu32ErrStatus          Pointer to the error state value
+ * @retval int32_t:
+ *           - LL_OK: The block is read at the new clock
+ *           - LL_ERR: Refer to pu32ErrStatus for the reason of error
+ *           - LL_ERR_TIMEOUT: Wait timeout
+ */
+static int32_t SDMMC_SetBusClock(CM_SDIOC_TypeDef *SDIOCx, uint32_t u32TestAddr,
+                                 stc_sdmmc_bus_config_t *pstcBusConfig, uint32_t *pu32ErrStatus)
+{
+    int32_t i32Ret;
+    uint32_t au32Data[1U];
+
+    i32Ret = SDMMC_SetHostClock(SDIOCx, pstcBusConfig);
+    if (LL_OK == i32Ret) {
+        SDMMC_ConfigReadBlock(SDIOCx, SDMMC_TEST_BLOCK_SIZE);
+        i32Ret = SDMMC_CMD17_ReadSingleBlock(SDIOCx, u32TestAddr, pu32ErrStatus);
+        if (LL_OK == i32Ret) {
+            i32Ret = SDMMC_ReadBlock(SDIOCx, SDMMC_TEST_BLOCK_SIZE, au32Data, 0UL, pu32ErrStatus);
+        }
+    }
+
+    return i32Ret;
+}
+
 /**
  * @brief  De-Initialize SDIOC.
  * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
@@ -1210,12 +1388,15 @@ int32_t SDIOC_DataStructInit(stc_sdioc_data_config_t *pstcDataConfig)
  * @retval int32_t:
  *           - LL_OK: Read data success
  *           - LL_ERR_INVD_PARAM: NULL == au8Data or (u32Len % 4U) != 0
+ * @note   A word aligned au8Data is filled by whole words, about four times faster than an unaligned one.
  */
 int32_t SDIOC_ReadBuffer(CM_SDIOC_TypeDef *SDIOCx, uint8_t au8Data[], uint32_t u32Len)
 {
     int32_t i32Ret = LL_OK;
     uint32_t i;
     uint32_t u32Temp;
+    uint32_t u32Word;
+    uint32_t *pu32Data;
     __IO uint32_t *BUF_REG;
 
     if ((NULL == au8Data) || (0U != (u32Len % 4U))) {
@@ -1225,12 +1406,31 @@ int32_t SDIOC_ReadBuffer(CM_SDIOC_TypeDef *SDIOCx, uint8_t au8Data[], uint32_t u
         DDL_ASSERT(IS_SDIOC_UNIT(SDIOCx));
 
         BUF_REG = SDIOC_BUF_ADDR(SDIOCx);
-        for (i = 0U; i < u32Len; i += 4U) {
-            u32Temp = READ_REG32(*BUF_REG);
-            au8Data[i]      = (uint8_t)(u32Temp & 0xFFUL);
-            au8Data[i + 1U] = (uint8_t)((u32Temp >> 8U) & 0xFFUL);
-            au8Data[i + 2U] = (uint8_t)((u32Temp >> 16U) & 0xFFUL);
-            au8Data[i + 3U] = (uint8_t)((u32Temp >> 24U) & 0xFFUL);
+        if (0UL == ((uint32_t)au8Data % 4UL)) {
+            pu32Data = (uint32_t *)(uint32_t)au8Data;
+            u32Word = u32Len / 4U;
+            /* A 512-byte block is 16 rounds */
+            for (i = 0U; (i + SDIOC_BUF_UNROLL_WORDS) <= u32Word; i += SDIOC_BUF_UNROLL_WORDS) {
+                pu32Data[i]      = READ_REG32(*BUF_REG);
+                pu32Data[i + 1U] = READ_REG32(*BUF_REG);
+                pu32Data[i + 2U] = READ_REG32(*BUF_REG);
+                pu32Data[i + 3U] = READ_REG32(*BUF_REG);
+                pu32Data[i + 4U] = READ_REG32(*BUF_REG);
+                pu32Data[i + 5U] = READ_REG32(*BUF_REG);
+                pu32Data[i + 6U] = READ_REG32(*BUF_REG);
+                pu32Data[i + 7U] = READ_REG32(*BUF_REG);
+            }
+            for (; i < u32Word; i++) {
+                pu32Data[i] = READ_REG32(*BUF_REG);
+            }
+        } else {
+            for (i = 0U; i < u32Len; i += 4U) {
+                u32Temp = READ_REG32(*BUF_REG);
+                au8Data[i]      = (uint8_t)(u32Temp & 0xFFUL);
+                au8Data[i + 1U] = (uint8_t)((u32Temp >> 8U) & 0xFFUL);
+                au8Data[i + 2U] = (uint8_t)((u32Temp >> 16U) & 0xFFUL);
+                au8Data[i + 3U] = (uint8_t)((u32Temp >> 24U) & 0xFFUL);
+            }
         }
     }
 
@@ -1248,12 +1448,15 @@ int32_t SDIOC_ReadBuffer(CM_SDIOC_TypeDef *SDIOCx, uint8_t au8Data[], uint32_t u
  * @retval int32_t:
  *           - LL_OK: Write data success
  *           - LL_ERR_INVD_PARAM: NULL == au8Data or (u32Len % 4U) != 0
+ * @note   A word aligned au8Data is read by whole words, about four times faster than an unaligned one.
  */
 int32_t SDIOC_WriteBuffer(CM_SDIOC_TypeDef *SDIOCx, const uint8_t au8Data[], uint32_t u32Len)
 {
     int32_t i32Ret = LL_OK;
     uint32_t i;
     uint32_t u32Temp;
+    uint32_t u32Word;
+    const uint32_t *pu32Data;
     __IO uint32_t *BUF_REG;
 
     if ((NULL == au8Data) || (0U != (u32Len % 4U))) {
@@ -1263,16 +1466,176 @@ int32_t SDIOC_WriteBuffer(CM_SDIOC_TypeDef *SDIOCx, const uint8_t au8Data[], uin
         DDL_ASSERT(IS_SDIOC_UNIT(SDIOCx));
 
         BUF_REG = SDIOC_BUF_ADDR(SDIOCx);
-        for (i = 0U; i < u32Len; i += 4U) {
-            u32Temp = ((uint32_t)au8Data[i + 3U] << 24U) | ((uint32_t)au8Data[i + 2U] << 16U) |
-                      ((uint32_t)au8Data[i + 1U] << 8U)  | au8Data[i];
-            WRITE_REG32(*BUF_REG, u32Temp);
+        if (0UL == ((uint32_t)au8Data % 4UL)) {
+            pu32Data = (const uint32_t *)(uint32_t)au8Data;
+            u32Word = u32Len / 4U;
+            /* A 512-byte block is 16 rounds */
+            for (i = 0U; (i + SDIOC_BUF_UNROLL_WORDS) <= u32Word; i += SDIOC_BUF_UNROLL_WORDS) {
+                WRITE_REG32(*BUF_REG, pu32Data[i]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 1U]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 2U]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 3U]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 4U]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 5U]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 6U]);
+                WRITE_REG32(*BUF_REG, pu32Data[i + 7U]);
+            }
+            for (; i < u32Word; i++) {
+                WRITE_REG32(*BUF_REG, pu32Data[i]);
+            }
+        } else {
+            for (i = 0U; i < u32Len; i += 4U) {
+                u32Temp = ((uint32_t)au8Data[i + 3U] << 24U) | ((uint32_t)au8Data[i + 2U] << 16U) |
+                          ((uint32_t)au8Data[i + 1U] << 8U)  | au8Data[i];
+                WRITE_REG32(*BUF_REG, u32Temp);
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
+#if (LL_DMA_ENABLE == DDL_ON)
+/**
+ * @brief  Build the DMA descriptor chain of a multi-block transfer.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in] u16TransDir             Data transfer direction
+ *         This parameter can be one of the following values:
+ *           @arg SDIOC_TRANS_DIR_TO_CARD:  Write (Host to Card)
+ *           @arg SDIOC_TRANS_DIR_TO_HOST:  Read (Card to Host)
+ * @param  [in] u16BlockSize            Data block size, a multiple of 4 between 4 and 512
+ * @param  [in] astcSg                  Scatter-gather list, one entry per buffer
+ * @param  [in] u32Num                  Number of the entries in astcSg
+ * @param  [out] astcDesc               Descriptor table with u32Num entries, kept alive until the transfer ends
+ * @retval int32_t:
+ *           - LL_OK: Build descriptor chain success
+ *           - LL_ERR_INVD_PARAM: An invalid parameter
+ * @note   The DMA channel moves one data block per request, the SDIOC data block count configured by
+ *         SDIOC_ConfigData() must be the sum of the u16BlockCount of all the entries.
+ */
+int32_t SDIOC_DMA_DescInit(const CM_SDIOC_TypeDef *SDIOCx, uint16_t u16TransDir, uint16_t u16BlockSize,
+                           const stc_sdioc_dma_sg_t astcSg[], uint32_t u32Num, stc_dma_llp_descriptor_t astcDesc[])
+{
+    int32_t i32Ret = LL_OK;
+    uint32_t u32BufAddr;
+    uint32_t u32ChCtrl;
+    uint32_t i;
+
+    if ((NULL == astcSg) || (NULL == astcDesc) || (0UL == u32Num) || (u16BlockSize < 4U) ||
+        (u16BlockSize > SDIOC_DMA_BLOCK_SIZE_MAX) || (0U != (u16BlockSize % 4U))) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        /* Check parameters */
+        DDL_ASSERT(IS_SDIOC_UNIT(SDIOCx));
+        DDL_ASSERT(IS_SDIOC_TRANS_DIR(u16TransDir));
+
+        u32BufAddr = (uint32_t)(&SDIOCx->BUF0);
+        if (SDIOC_TRANS_DIR_TO_HOST == u16TransDir) {
+            u32ChCtrl = DMA_SRC_ADDR_FIX | DMA_DEST_ADDR_INC | DMA_DATAWIDTH_32BIT;
+        } else {
+            u32ChCtrl = DMA_SRC_ADDR_INC | DMA_DEST_ADDR_FIX | DMA_DATAWIDTH_32BIT;
+        }
+
+        for (i = 0UL; i < u32Num; i++) {
+            if ((0U == astcSg[i].u16BlockCount) || (0UL != (astcSg[i].u32Addr % 4UL))) {
+                i32Ret = LL_ERR_INVD_PARAM;
+                break;
+            }
+            if (SDIOC_TRANS_DIR_TO_HOST == u16TransDir) {
+                astcDesc[i].SARx = u32BufAddr;
+                astcDesc[i].DARx = astcSg[i].u32Addr;
+            } else {
+                astcDesc[i].SARx = astcSg[i].u32Addr;
+                astcDesc[i].DARx = u32BufAddr;
+            }
+            astcDesc[i].DTCTLx    = ((uint32_t)u16BlockSize / 4UL) | ((uint32_t)astcSg[i].u16BlockCount << DMA_DTCTL_CNT_POS);
+            astcDesc[i].RPTx      = 0UL;
+            astcDesc[i].SNSEQCTLx = 0UL;
+            astcDesc[i].DNSEQCTLx = 0UL;
+            /* The next descriptor is loaded at the end of this one and waits for the next block request */
+            if (i < (u32Num - 1UL)) {
+                astcDesc[i].LLPx   = (uint32_t)&astcDesc[i + 1UL];
+                astcDesc[i].CHCTLx = u32ChCtrl | DMA_LLP_ENABLE | DMA_LLP_WAIT;
+            } else {
+                astcDesc[i].LLPx   = 0UL;
+                astcDesc[i].CHCTLx = u32ChCtrl | DMA_INT_ENABLE;
+            }
         }
     }
 
     return i32Ret;
 }
 
+/**
+ * @brief  Start the DMA channel with a descriptor chain built by SDIOC_DMA_DescInit().
+ * @param  [in] DMAx                    DMA unit instance
+ * @param  [in] u8Ch                    DMA channel. @ref DMA_Channel_selection
+ * @param  [in] pstcDesc                Pointer to the first descriptor
+ * @retval int32_t:
+ *           - LL_OK: Start success
+ *           - LL_ERR_INVD_PARAM: NULL == pstcDesc
+ * @note   1)Enable the DMA unit by DMA_Cmd() and route the trigger of the channel to EVT_SRC_SDIOCx_DMAR
+ *           (read) or EVT_SRC_SDIOCx_DMAW (write) by AOS_SetTriggerEventSrc() first.
+ *         2)Call it after SDIOC_ConfigData() and before sending CMD18 or CMD25. The end of the transfer is
+ *           signaled by the SDIOC transfer complete interrupt, see SDIOC_DMA_GetTransStatus().
+ */
+int32_t SDIOC_DMA_Start(CM_DMA_TypeDef *DMAx, uint8_t u8Ch, const stc_dma_llp_descriptor_t *pstcDesc)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcDesc) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        (void)DMA_ChCmd(DMAx, u8Ch, DISABLE);
+        (void)DMA_RestoreChConfig(DMAx, u8Ch, pstcDesc);
+        DMA_ClearTransCompleteStatus(DMAx, (DMA_FLAG_TC_CH0 | DMA_FLAG_BTC_CH0) << u8Ch);
+        DMA_ClearErrStatus(DMAx, (DMA_FLAG_TRANS_ERR_CH0 | DMA_FLAG_REQ_ERR_CH0) << u8Ch);
+        i32Ret = DMA_ChCmd(DMAx, u8Ch, ENABLE);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the status of a DMA multi-block transfer, and stop the DMA channel when it ends.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in] DMAx                    DMA unit instance
+ * @param  [in] u8Ch                    DMA channel. @ref DMA_Channel_selection
+ * @retval int32_t:
+ *           - LL_OK: Transfer complete
+ *           - LL_ERR_BUSY: Transfer ongoing
+ *           - LL_ERR: Data or DMA error, send CMD12 and reset the data line by SDIOC_SWReset()
+ * @note   Call it from the SDIOC interrupt with SDIOC_INT_TCSEN and the data error interrupts enabled, or poll it.
+ */
+int32_t SDIOC_DMA_GetTransStatus(CM_SDIOC_TypeDef *SDIOCx, CM_DMA_TypeDef *DMAx, uint8_t u8Ch)
+{
+    int32_t i32Ret = LL_ERR_BUSY;
+    const uint32_t u32DmaErrFlag = (DMA_FLAG_TRANS_ERR_CH0 | DMA_FLAG_REQ_ERR_CH0) << u8Ch;
+
+    if ((SET == SDIOC_GetIntStatus(SDIOCx, SDIOC_DMA_DATA_ERR_FLAG)) || (SET == DMA_GetErrStatus(DMAx, u32DmaErrFlag))) {
+        i32Ret = LL_ERR;
+    } else if (SET == SDIOC_GetIntStatus(SDIOCx, SDIOC_INT_FLAG_TC)) {
+        i32Ret = LL_OK;
+    } else {
+        /* rsvd */
+    }
+
+    if (LL_ERR_BUSY != i32Ret) {
+        (void)DMA_ChCmd(DMAx, u8Ch, DISABLE);
+        DMA_ClearErrStatus(DMAx, u32DmaErrFlag);
+        SDIOC_ClearIntStatus(SDIOCx, SDIOC_DMA_DATA_ERR_FLAG | SDIOC_INT_FLAG_TC);
+    }
+
+    return i32Ret;
+}
+#endif /* LL_DMA_ENABLE */
+
 /**
  * @brief  Enable or disable block gap stop.
  * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
@@ -2852,6 +3215,117 @@ int32_t SDMMC_CMD53_IORwExtended(CM_SDIOC_TypeDef *SDIOCx, const stc_sdio_cmd53_
     return i32Ret;
 }
 
+/**
+ * @brief  Bring an SD card up to the fastest bus mode it supports.
+ * @param  [in] SDIOCx                  Pointer to SDIOC unit instance
+ *         This parameter can be one of the following values:
+ *           @arg CM_SDIOC1:            SDIOC unit 1 instance
+ *           @arg CM_SDIOC2:            SDIOC unit 2 instance
+ * @param  [in] u32RCA                  Relative Card Address
+ * @param  [in] u32TestAddr             Address of a readable block used to verify the bus, a block address for
+ *                                      SDHC/SDXC cards and a byte address for SDSC cards
+ * @param  [out] pstcBusConfig          Pointer to a @ref stc_sdmmc_bus_config_t structure of the result
+ * @param  [out] pu32ErrStatus          Pointer to the error state value
+ * @retval int32_t:
+ *           - LL_OK: The bus runs at the mode in pstcBusConfig
+ *           - LL_ERR: Refer to pu32ErrStatus for the reason of error
+ *           - LL_ERR_INVD_PARAM: pstcBusConfig == NULL or pu32ErrStatus == NULL
+ *           - LL_ERR_INVD_MD: SDIOCx is not in SD mode
+ *           - LL_ERR_TIMEOUT: Wait timeout
+ * @note   1)Call it with the card selected by CMD7, in 1-bit default speed mode and with 512-byte blocks.
+ *         2)The bus width is switched to 4-bit if the SCR allows it. The card is switched to high speed by
+ *           CMD6 if it supports it, and the clock is set to 50MHz, otherwise to 25MHz. If the test read fails
+ *           in high speed mode, the card is switched back to default speed by CMD6 at 25MHz and read again.
+ */
+int32_t SDMMC_BusSpeedUp(CM_SDIOC_TypeDef *SDIOCx, uint32_t u32RCA, uint32_t u32TestAddr,
+                         stc_sdmmc_bus_config_t *pstcBusConfig, uint32_t *pu32ErrStatus)
+{
+    int32_t i32Ret;
+    uint32_t au32Data[SDMMC_SWITCH_STATUS_SIZE / 4U];
+    uint32_t u32Scr;
+
+    if ((NULL == pstcBusConfig) || (NULL == pu32ErrStatus)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (SDIOC_MD_SD != SDIOC_GetMode(SDIOCx)) {
+        return LL_ERR_INVD_MD;
+    }
+
+    pstcBusConfig->u8BusWidth  = SDIOC_BUS_WIDTH_1BIT;
+    pstcBusConfig->u8SpeedMode = SDIOC_SPEED_MD_NORMAL;
+    /* The SCR is sent MSB first */
+    i32Ret = SDMMC_CMD55_AppCmd(SDIOCx, (u32RCA << 16U), pu32ErrStatus);
+    if (LL_OK == i32Ret) {
+        SDMMC_ConfigReadBlock(SDIOCx, SDMMC_SCR_SIZE);
+        i32Ret = SDMMC_ACMD51_SendSCR(SDIOCx, pu32ErrStatus);
+        if (LL_OK == i32Ret) {
+            i32Ret = SDMMC_ReadBlock(SDIOCx, SDMMC_SCR_SIZE, au32Data, 1UL, pu32ErrStatus);
+        }
+    }
+    if (LL_OK != i32Ret) {
+        return i32Ret;
+    }
+    u32Scr = __REV(au32Data[0]);
+
+    if (0UL != (u32Scr & SDMMC_SCR_BUS_WIDTH_4BIT)) {
+        i32Ret = SDMMC_CMD55_AppCmd(SDIOCx, (u32RCA << 16U), pu32ErrStatus);
+        if (LL_OK == i32Ret) {
+            i32Ret = SDMMC_ACMD6_SetBusWidth(SDIOCx, SDMMC_ACMD6_BUS_WIDTH_4BIT, pu32ErrStatus);
+        }
+        if (LL_OK == i32Ret) {
+            SDIOC_SetBusWidth(SDIOCx, SDIOC_BUS_WIDTH_4BIT);
+            pstcBusConfig->u8BusWidth = SDIOC_BUS_WIDTH_4BIT;
+        }
+    }
+
+    /* CMD6 is supported from the physical layer specification 1.10 */
+    if ((LL_OK == i32Ret) && ((u32Scr & SDMMC_SCR_PHY_SPEC_VER_MASK) >= SDMMC_SCR_PHY_SPEC_VER_1P1)) {
+        SDMMC_ConfigReadBlock(SDIOCx, SDMMC_SWITCH_STATUS_SIZE);
+        i32Ret = SDMMC_CMD6_SwitchFunc(SDIOCx, SDMMC_CMD6_CHECK_HIGH_SPEED, pu32ErrStatus);
+        if (LL_OK == i32Ret) {
+            i32Ret = SDMMC_ReadBlock(SDIOCx, SDMMC_SWITCH_STATUS_SIZE, au32Data, SDMMC_SWITCH_STATUS_SIZE / 4U,
+                                     pu32ErrStatus);
+        }
+        if ((LL_OK == i32Ret) && (0UL != (au32Data[3U] & SDMMC_SWITCH_HIGH_SPEED_SUPPORT))) {
+            SDMMC_ConfigReadBlock(SDIOCx, SDMMC_SWITCH_STATUS_SIZE);
+            i32Ret = SDMMC_CMD6_SwitchFunc(SDIOCx, SDMMC_CMD6_SET_HIGH_SPEED, pu32ErrStatus);
+            if (LL_OK == i32Ret) {
+                i32Ret = SDMMC_ReadBlock(SDIOCx, SDMMC_SWITCH_STATUS_SIZE, au32Data, SDMMC_SWITCH_STATUS_SIZE / 4U,
+                                         pu32ErrStatus);
+            }
+            if ((LL_OK == i32Ret) && (SDMMC_SWITCH_HIGH_SPEED_DONE == (au32Data[4U] & SDMMC_SWITCH_GROUP1_RESULT))) {
+                pstcBusConfig->u8SpeedMode = SDIOC_SPEED_MD_HIGH;
+            }
+        }
+    }
+
+    if (LL_OK == i32Ret) {
+        i32Ret = SDMMC_SetBusClock(SDIOCx, u32TestAddr, pstcBusConfig, pu32ErrStatus);
+        if ((LL_OK != i32Ret) && (SDIOC_SPEED_MD_HIGH == pstcBusConfig->u8SpeedMode)) {
+            /* Host and card go back to default speed together */
+            pstcBusConfig->u8SpeedMode = SDIOC_SPEED_MD_NORMAL;
+            i32Ret = SDMMC_SetHostClock(SDIOCx, pstcBusConfig);
+            if (LL_OK == i32Ret) {
+                SDMMC_ConfigReadBlock(SDIOCx, SDMMC_SWITCH_STATUS_SIZE);
+                i32Ret = SDMMC_CMD6_SwitchFunc(SDIOCx, SDMMC_CMD6_SET_DEFAULT_SPEED, pu32ErrStatus);
+            }
+            if (LL_OK == i32Ret) {
+                i32Ret = SDMMC_ReadBlock(SDIOCx, SDMMC_SWITCH_STATUS_SIZE, au32Data, SDMMC_SWITCH_STATUS_SIZE / 4U,
+                                         pu32ErrStatus);
+            }
+            if ((LL_OK == i32Ret) &&
+                (SDMMC_SWITCH_DEFAULT_SPEED_DONE != (au32Data[4U] & SDMMC_SWITCH_GROUP1_RESULT))) {
+                i32Ret = LL_ERR;
+            }
+            if (LL_OK == i32Ret) {
+                i32Ret = SDMMC_SetBusClock(SDIOCx, u32TestAddr, pstcBusConfig, pu32ErrStatus);
+            }
+        }
+    }
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add key context API to reuse the expanded key
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -137,6 +138,8 @@ typedef struct {
 (   (((md) == SKE_MD_GCM) && IS_SKE_GCM_MAC_SIZE(s))    ||                     \
     (((md) == SKE_MD_CCM) && IS_SKE_CCM_MAC_SIZE(s)))
 
+#define IS_SKE_KEY_CTX_MD(x)            IS_SKE_BASE_MD(x)
+
 #define IS_SKE_FLAG(x)                  IS_ADC_BIT_MASK(x, SKE_FLAG_ALL)
 #define IS_SKE_FLAG_CLR(x)              IS_ADC_BIT_MASK(x, SKE_FLAG_CLR_ALL)
 /**
@@ -168,6 +171,8 @@ typedef struct {
 #define SKE_SET_LAST_BLOCK_MARK()       WRITE_REG32(bCM_SKE->DIN_CR_b.LAST, 1U)
 #define SKE_RESET_LAST_BLOCK_MARK()     WRITE_REG32(bCM_SKE->DIN_CR_b.LAST, 0U)
 #define SKE_CFG_UPD_CMD(cmd)            WRITE_REG32(bCM_SKE->CFG_b.UP_CFG, (cmd))
+/* The key schedule in SKE no longer belongs to any key context */
+#define SKE_KEY_CTX_INVD()              (m_pstcSkeResidentKeyCtx = NULL)
 /**
  * @}
  */
@@ -193,6 +198,8 @@ typedef struct {
  */
 static const uint8_t m_au8SkeAlgBlockSize[] = {0U, 16U, 16U, 8U, 16U, 16U};
 static const uint8_t m_au8SkeAlgKeySize[] = {0U, 16U, 16U, 8U, 24U, 32U};
+/* The key context whose key schedule is currently expanded in SKE */
+static stc_ske_key_ctx_t *m_pstcSkeResidentKeyCtx = NULL;
 /**
  * @}
  */
@@ -749,6 +756,72 @@ static int32_t SKE_CcmUpdateAadBlocks(stc_ske_ccm_ctx_t *pCtx, const uint8_t *pu
 
     return i32Ret;
 }
+
+/**
+ * @brief  XOR two buffers byte by byte.
+ * @param  [out] pu8Dest                Pointer to destination data buffer.
+ * @param  [in]  pu8Src1                Pointer to source data buffer1.
+ * @param  [in]  pu8Src2                Pointer to source data buffer2.
+ * @param  [in]  u32Size                Size(in byte) of the data to be XORed.
+ * @retval None
+ */
+static void SKE_XorByte(uint8_t *pu8Dest, const uint8_t *pu8Src1, const uint8_t *pu8Src2, uint32_t u32Size)
+{
+    uint32_t i;
+    for (i = 0U; i < u32Size; i++) {
+        pu8Dest[i] = pu8Src1[i] ^ pu8Src2[i];
+    }
+}
+
+/**
+ * @brief  Increase the counter block of CTR mode by one, big endian.
+ * @param  [in,out] pu8Counter          Pointer to the counter block.
+ * @param  [in]  u32Size                Size(in byte) of the counter block.
+ * @retval None
+ */
+static void SKE_IncCounter(uint8_t *pu8Counter, uint32_t u32Size)
+{
+    uint32_t i = u32Size;
+
+    while (i > 0U) {
+        i--;
+        pu8Counter[i]++;
+        if (pu8Counter[i] != 0U) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief  Expand the key of the specified key context in SKE.
+ * @param  [in]  pstcCtx                Pointer to a @ref stc_ske_key_ctx_t structure.
+ * @param  [in]  u32Crypto              Direction of the key schedule.
+ *                                      This parameter can be a value of @ref SKE_Crypto_Action
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR:                  SKE is busy.
+ *           - LL_ERR_TIMEOUT:          Expand the key timeout.
+ * @note The key context is configured as ECB mode, the other modes are chained by software,
+ *       so the key schedule can be kept across packets and IVs.
+ */
+static int32_t SKE_KeyCtxLoad(stc_ske_key_ctx_t *pstcCtx, uint32_t u32Crypto)
+{
+    int32_t i32Ret;
+    stc_ske_init_t stcSkeInit;
+
+    (void)SKE_StructInit(&stcSkeInit);
+    stcSkeInit.u32Alg    = pstcCtx->u32Alg;
+    stcSkeInit.u32Mode   = SKE_MD_ECB;
+    stcSkeInit.u32Crypto = u32Crypto;
+    stcSkeInit.pu8Key    = (const uint8_t *)pstcCtx->au32Key;
+    i32Ret = SKE_Init(&stcSkeInit);
+    if (i32Ret == LL_OK) {
+        pstcCtx->u32Crypto = u32Crypto;
+        m_pstcSkeResidentKeyCtx = pstcCtx;
+    }
+
+    return i32Ret;
+}
 /**
  * @}
  */
@@ -793,6 +866,7 @@ int32_t SKE_Init(const stc_ske_init_t *pstcSkeInit)
 
     /* Clear SKE done flag. */
     WRITE_REG32(bCM_SKE->SR2_b.CORE_DONE, 0U);
+    SKE_KEY_CTX_INVD();
     /* Preparation for initialization of GCM/CCM/CMAC modes */
     if (pstcSkeInit->u32Mode == SKE_MD_GCM) {
         i32Ret = SKE_GcmPrepareInit(pstcSkeInit);
@@ -865,6 +939,7 @@ int32_t SKE_DeInit(void)
     /* Check FRST register protect */
     DDL_ASSERT((CM_PWC->FPRC & PWC_FPRC_FPRCB1) == PWC_FPRC_FPRCB1);
 
+    SKE_KEY_CTX_INVD();
     /* Reset CANx */
     WRITE_REG32(bCM_RMU->FRST0_b.SKE, 0UL);
 
@@ -892,6 +967,7 @@ void SKE_UpdateConfigCmd(en_functional_state_t enNewState)
 {
     /* Check function parameters */
     DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+    SKE_KEY_CTX_INVD();
     SKE_CFG_UPD_CMD(enNewState);
 }
 
@@ -909,6 +985,7 @@ void SKE_SetDataType(uint32_t u32DataType)
 {
     /* Check function parameters */
     DDL_ASSERT(IS_SKE_DATA_TYPE(u32DataType));
+    SKE_KEY_CTX_INVD();
     MODIFY_REG32(CM_SKE->CFG, SKE_CFG_DATA_TYPE, u32DataType);
 }
 
@@ -924,6 +1001,7 @@ void SKE_SetCrypto(uint32_t u32Crypto)
 {
     /* Check function parameters */
     DDL_ASSERT(IS_SKE_CRYPTO(u32Crypto));
+    SKE_KEY_CTX_INVD();
     WRITE_REG32(bCM_SKE->CFG_b.DEC, u32Crypto);
 }
 
@@ -941,6 +1019,7 @@ void SKE_SetAlgorithm(uint32_t u32Alg)
 {
     /* Check function parameters */
     DDL_ASSERT(IS_SKE_ALG(u32Alg));
+    SKE_KEY_CTX_INVD();
     MODIFY_REG32(CM_SKE->CFG, SKE_CFG_ALG, u32Alg);
 }
 
@@ -961,6 +1040,7 @@ void SKE_SetMode(uint32_t u32Mode)
 {
     /* Check function parameters */
     DDL_ASSERT(IS_SKE_MD(u32Mode));
+    SKE_KEY_CTX_INVD();
     /* Update operation mode */
     MODIFY_REG32(CM_SKE->CFG, SKE_CFG_MODE, u32Mode);
 }
@@ -1031,6 +1111,7 @@ int32_t SKE_SetKey(uint32_t u32Alg, const uint8_t *pu8Key)
         return LL_ERR_INVD_PARAM;
     }
 
+    SKE_KEY_CTX_INVD();
     u8WordSize = m_au8SkeAlgKeySize[u32Alg] / 4U;
     /* Write KEY registers */
     for (i = 0U; i < u8WordSize; i++) {
@@ -1052,6 +1133,7 @@ int32_t SKE_ExpandKey(void)
 {
     int32_t i32Ret;
 
+    SKE_KEY_CTX_INVD();
     /* Enable configuration update */
     SKE_CFG_UPD_CMD(ENABLE);
     /* Expand key */
@@ -1506,6 +1588,165 @@ int32_t SKE_XcmFinal(stc_ske_xcm_final_t *pstcFinal)
     return i32Ret;
 }
 
+/**
+ * @brief  Initializes a key context and expands its key in SKE.
+ * @param  [out] pstcCtx                Pointer to a @ref stc_ske_key_ctx_t structure to be initialized.
+ * @param  [in]  u32Alg                 SKE algorithm.
+ *                                      This parameter can be a value of @ref SKE_Algorithm
+ *   @arg  SKE_ALG_AES_128:             SKE algorithm is AES-128.
+ *   @arg  SKE_ALG_AES_192:             SKE algorithm is AES-192.
+ *   @arg  SKE_ALG_AES_256:             SKE algorithm is AES-256.
+ *   @arg  SKE_ALG_SM4:                 SKE algorithm is SM4.
+ *   @arg  SKE_ALG_DES:                 SKE algorithm is DES.
+ * @param  [in]  pu8Key                 Pointer to the key buffer. The key size is determined by the algorithm.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcCtx == NULL or pu8Key == NULL or invalid algorithm parameter.
+ *           - LL_ERR:                  SKE is busy.
+ *           - LL_ERR_TIMEOUT:          Expand the key timeout.
+ * @note The key is expanded once here. SKE_KeyCtxCrypto() reuses the expanded key as long as no
+ *       other SKE configuration(SKE_Init(), SKE_SetKey(), another key context, etc.) is done in between.
+ */
+int32_t SKE_KeyCtxInit(stc_ske_key_ctx_t *pstcCtx, uint32_t u32Alg, const uint8_t *pu8Key)
+{
+    if ((pstcCtx == NULL) || (pu8Key == NULL) || (!IS_SKE_ALG(u32Alg))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (m_pstcSkeResidentKeyCtx == pstcCtx) {
+        SKE_KEY_CTX_INVD();
+    }
+    pstcCtx->u32Alg = u32Alg;
+    SKE_SetByte((uint8_t *)pstcCtx->au32Key, 0U, sizeof(pstcCtx->au32Key));
+    SKE_CopyByte((uint8_t *)pstcCtx->au32Key, pu8Key, m_au8SkeAlgKeySize[u32Alg]);
+
+    return SKE_KeyCtxLoad(pstcCtx, SKE_CRYPTO_ENCRYPT);
+}
+
+/**
+ * @brief  De-initializes a key context and clears the key copy in it.
+ * @param  [in]  pstcCtx                Pointer to a @ref stc_ske_key_ctx_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcCtx == NULL.
+ */
+int32_t SKE_KeyCtxDeInit(stc_ske_key_ctx_t *pstcCtx)
+{
+    if (pstcCtx == NULL) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if (m_pstcSkeResidentKeyCtx == pstcCtx) {
+        SKE_KEY_CTX_INVD();
+    }
+    SKE_SetByte((uint8_t *)pstcCtx->au32Key, 0U, sizeof(pstcCtx->au32Key));
+
+    return LL_OK;
+}
+
+/**
+ * @brief  SKE crypto all blocks of plaintext or ciphertext with the key of the specified key context.
+ * @param  [in]  pstcCtx                Pointer to a @ref stc_ske_key_ctx_t structure which has been
+ *                                      initialized by SKE_KeyCtxInit().
+ * @param  [in]  pstcCrypto             Pointer to a @ref stc_ske_key_ctx_crypto_t structure value that
+ *                                      contains the information for crypto.
+ * @retval int32_t:
+ *           - LL_OK:                   The specified blocks updated with no error occurred.
+ *           - LL_ERR_INVD_PARAM:       Parameters invalid.
+ *           - LL_ERR:                  SKE is busy when the key needs to be expanded again.
+ *           - LL_ERR_TIMEOUT:          SKE calculation timeout.
+ * @note 1. The key is loaded and expanded again only if SKE was reconfigured after the last call, or
+ *          ECB/CBC mode decrypting is requested after encrypting and vice versa.
+ *          CFB/OFB/CTR modes use the encrypting key schedule in both directions.
+ * @note 2. ECB and CBC modes: if pstcCrypto->u32CryptoSize % u32BlockSize != 0, the remain data bytes
+ *          of the last block will be set to zero, the same as SKE_CryptoBlocks().
+ *          CFB, OFB and CTR modes: the last partial block is processed as a stream.
+ * @note 3. CTR mode increases the whole counter block as a big endian number.
+ */
+int32_t SKE_KeyCtxCrypto(stc_ske_key_ctx_t *pstcCtx, stc_ske_key_ctx_crypto_t *pstcCrypto)
+{
+    uint32_t i;
+    uint32_t u32Alg;
+    uint32_t u32Size;
+    uint32_t u32BlockSize;
+    uint32_t u32KeyCrypto = SKE_CRYPTO_ENCRYPT;
+    int32_t i32Ret = LL_OK;
+    uint8_t au8In[SKE_BLOCK_SIZE_MAX];
+    uint8_t au8Out[SKE_BLOCK_SIZE_MAX];
+
+    if ((pstcCtx == NULL) || (pstcCrypto == NULL) || (pstcCrypto->pu8In == NULL) || \
+        (pstcCrypto->pu8Out == NULL) || (pstcCrypto->u32CryptoSize == 0U) || \
+        (!IS_SKE_ALG(pstcCtx->u32Alg)) || (!IS_SKE_KEY_CTX_MD(pstcCrypto->u32Mode)) || \
+        ((pstcCrypto->u32Mode != SKE_MD_ECB) && (pstcCrypto->pu8Iv == NULL))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    DDL_ASSERT(IS_SKE_CRYPTO(pstcCrypto->u32Crypto));
+
+    u32Alg = pstcCtx->u32Alg;
+    if ((pstcCrypto->u32Crypto == SKE_CRYPTO_DECRYPT) && \
+        ((pstcCrypto->u32Mode == SKE_MD_ECB) || (pstcCrypto->u32Mode == SKE_MD_CBC))) {
+        u32KeyCrypto = SKE_CRYPTO_DECRYPT;
+    }
+
+    /* Load and expand the key only if the key schedule in SKE is not the required one */
+    if ((m_pstcSkeResidentKeyCtx != pstcCtx) || (pstcCtx->u32Crypto != u32KeyCrypto)) {
+        i32Ret = SKE_KeyCtxLoad(pstcCtx, u32KeyCrypto);
+        if (i32Ret != LL_OK) {
+            return i32Ret;
+        }
+    }
+
+    u32BlockSize = m_au8SkeAlgBlockSize[u32Alg];
+    for (i = 0U; i < pstcCrypto->u32CryptoSize; i += u32BlockSize) {
+        u32Size = LL_MIN(u32BlockSize, pstcCrypto->u32CryptoSize - i);
+        SKE_SetByte(au8In, 0U, u32BlockSize);
+        SKE_CopyByte(au8In, &pstcCrypto->pu8In[i], u32Size);
+
+        switch (pstcCrypto->u32Mode) {
+            case SKE_MD_CBC:
+                if (pstcCrypto->u32Crypto == SKE_CRYPTO_ENCRYPT) {
+                    SKE_XorByte(au8In, au8In, pstcCrypto->pu8Iv, u32BlockSize);
+                    i32Ret = SKE_UpdateOneBlock(u32Alg, SKE_MD_ECB, au8In, au8Out, 0U);
+                    SKE_CopyByte(pstcCrypto->pu8Iv, au8Out, u32BlockSize);
+                } else {
+                    i32Ret = SKE_UpdateOneBlock(u32Alg, SKE_MD_ECB, au8In, au8Out, 0U);
+                    SKE_XorByte(au8Out, au8Out, pstcCrypto->pu8Iv, u32BlockSize);
+                    SKE_CopyByte(pstcCrypto->pu8Iv, au8In, u32BlockSize);
+                }
+                break;
+            case SKE_MD_CFB:
+                i32Ret = SKE_UpdateOneBlock(u32Alg, SKE_MD_ECB, pstcCrypto->pu8Iv, au8Out, 0U);
+                SKE_XorByte(au8Out, au8Out, au8In, u32BlockSize);
+                if (pstcCrypto->u32Crypto == SKE_CRYPTO_ENCRYPT) {
+                    SKE_CopyByte(pstcCrypto->pu8Iv, au8Out, u32BlockSize);
+                } else {
+                    SKE_CopyByte(pstcCrypto->pu8Iv, au8In, u32BlockSize);
+                }
+                break;
+            case SKE_MD_OFB:
+                i32Ret = SKE_UpdateOneBlock(u32Alg, SKE_MD_ECB, pstcCrypto->pu8Iv, pstcCrypto->pu8Iv, 0U);
+                SKE_XorByte(au8Out, pstcCrypto->pu8Iv, au8In, u32BlockSize);
+                break;
+            case SKE_MD_CTR:
+                i32Ret = SKE_UpdateOneBlock(u32Alg, SKE_MD_ECB, pstcCrypto->pu8Iv, au8Out, 0U);
+                SKE_XorByte(au8Out, au8Out, au8In, u32BlockSize);
+                SKE_IncCounter(pstcCrypto->pu8Iv, u32BlockSize);
+                break;
+            default:
+                /* SKE_MD_ECB */
+                i32Ret = SKE_UpdateOneBlock(u32Alg, SKE_MD_ECB, au8In, au8Out, 0U);
+                break;
+        }
+        if (i32Ret != LL_OK) {
+            break;
+        }
+        SKE_CopyByte(&pstcCrypto->pu8Out[i], au8Out, u32Size);
+    }
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
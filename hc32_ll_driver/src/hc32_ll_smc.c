@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add nanosecond timing conversion and memory test driven timing tuner
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -168,6 +169,18 @@
 
 #define SMC_TMCR_RESV_BITS                  (0x00020000UL)
 
+/* Timing fields in the order they are tightened by EXMC_SMC_TuneTiming() */
+#define EXMC_SMC_TUNE_CEOE                  (0U)
+#define EXMC_SMC_TUNE_WP                    (1U)
+#define EXMC_SMC_TUNE_RC                    (2U)
+#define EXMC_SMC_TUNE_WC                    (3U)
+#define EXMC_SMC_TUNE_TR                    (4U)
+#define EXMC_SMC_TUNE_ADV                   (5U)
+#define EXMC_SMC_TUNE_FIELD_NUM             (6U)
+
+#define EXMC_SMC_TEST_SEED                  (0x5A5A5A5AUL)
+#define EXMC_SMC_TEST_PATTERN(seed, i)      (((i) * 0x9E3779B9UL) ^ (seed))
+
 /**
  * @}
  */
@@ -187,6 +200,91 @@
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
+/**
+ * @defgroup EXMC_SMC_Local_Functions EXMC_SMC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Convert a time in nanoseconds to memory clock cycles, rounded up.
+ * @param  [in] u32Ns                   Time in nanoseconds.
+ * @param  [in] u32ClockKhz             Memory clock in kHz.
+ * @retval Number of cycles.
+ */
+static uint32_t EXMC_SMC_NsToCycle(uint32_t u32Ns, uint32_t u32ClockKhz)
+{
+    return ((u32Ns * u32ClockKhz) + 999999UL) / 1000000UL;
+}
+
+/**
+ * @brief  Set the timing of a chip and keep its chip configuration.
+ * @param  [in] u32Chip                 The chip number.
+ * @param  [in] pstcTimingConfig        Pointer to a @ref stc_exmc_smc_timing_config_t structure.
+ * @retval None
+ */
+static void EXMC_SMC_SetTiming(uint32_t u32Chip, const stc_exmc_smc_timing_config_t *pstcTimingConfig)
+{
+    stc_exmc_smc_chip_config_t stcChipConfig;
+
+    (void)EXMC_SMC_GetChipConfig(u32Chip, &stcChipConfig);
+    WRITE_REG32(CM_SMC->TMCR, ((uint32_t)pstcTimingConfig->u8RC << SMC_TMCR_T_RC_POS) | \
+                ((uint32_t)pstcTimingConfig->u8WC << SMC_TMCR_T_WC_POS) | \
+                ((uint32_t)pstcTimingConfig->u8CEOE << SMC_TMCR_T_CEOE_POS) | \
+                ((uint32_t)pstcTimingConfig->u8WP << SMC_TMCR_T_WP_POS) | \
+                ((uint32_t)pstcTimingConfig->u8TR << SMC_TMCR_T_TR_POS) | \
+                ((uint32_t)pstcTimingConfig->u8ADV << SMC_TMCR_T_ADV_POS) | \
+                SMC_TMCR_RESV_BITS);
+    /* UpdateRegs loads the chip configuration register as well */
+    WRITE_REG32(CM_SMC->CPCR, stcChipConfig.u32ReadMode | stcChipConfig.u32WriteMode | \
+                stcChipConfig.u32MemoryWidth | stcChipConfig.u32ADV | stcChipConfig.u32BLS);
+    EXMC_SMC_SetCommand(u32Chip, EXMC_SMC_CMD_UPDATEREGS, EXMC_SMC_CRE_POLARITY_LOW, 0UL);
+}
+
+/**
+ * @brief  Test a memory area with word and half-word patterns.
+ * @param  [in] u32Addr                 Start address, word aligned.
+ * @param  [in] u32Words                Number of words.
+ * @retval int32_t:
+ *           - LL_OK:                   All the patterns are read back.
+ *           - LL_ERR:                  A pattern is read back wrong.
+ * @note   The contents of the area are destroyed.
+ */
+static int32_t EXMC_SMC_MemTest(uint32_t u32Addr, uint32_t u32Words)
+{
+    uint32_t i;
+    uint32_t u32Pass;
+    uint32_t u32Seed;
+    __IO uint32_t *pu32Mem = (__IO uint32_t *)u32Addr;
+    __IO uint16_t *pu16Mem = (__IO uint16_t *)u32Addr;
+
+    for (u32Pass = 0UL; u32Pass < 2UL; u32Pass++) {
+        u32Seed = (0UL == u32Pass) ? EXMC_SMC_TEST_SEED : ~EXMC_SMC_TEST_SEED;
+        for (i = 0UL; i < u32Words; i++) {
+            pu32Mem[i] = EXMC_SMC_TEST_PATTERN(u32Seed, i);
+        }
+        /* Read back in reverse order so that no access hits the row just written */
+        for (i = u32Words; i > 0UL; i--) {
+            if (pu32Mem[i - 1UL] != EXMC_SMC_TEST_PATTERN(u32Seed, i - 1UL)) {
+                return LL_ERR;
+            }
+        }
+    }
+
+    /* Half-word writes exercise the byte lanes, each read follows a write */
+    for (i = 0UL; i < u32Words; i++) {
+        pu16Mem[(i * 2UL) + 1UL] = (uint16_t)i;
+        if (pu32Mem[i] != ((EXMC_SMC_TEST_PATTERN(~EXMC_SMC_TEST_SEED, i) & 0xFFFFUL) | (i << 16U))) {
+            return LL_ERR;
+        }
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @}
+ */
+
 /**
  * @defgroup EXMC_SMC_Global_Functions EXMC_SMC Global Functions
  * @{
@@ -488,6 +586,142 @@ int32_t EXMC_SMC_GetTimingConfig(uint32_t u32Chip, stc_exmc_smc_timing_config_t
     return i32Ret;
 }
 
+/**
+ * @brief  Convert the datasheet timings in nanoseconds to SMC timing cycles.
+ * @param  [in] pstcTimingNs            Pointer to a @ref stc_exmc_smc_timing_ns_t structure.
+ * @param  [in] u32ExclkFreq            EXMC clock frequency in Hz, e.g. CLK_GetBusClockFreq(CLK_BUS_EXCLK).
+ * @param  [out] pstcTimingConfig       Pointer to a @ref stc_exmc_smc_timing_config_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Convert successfully.
+ *           - LL_ERR:                  A timing needs more cycles than its field holds, lower the EXMC clock.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL, or u32ExclkFreq is less than 1kHz.
+ * @note   Each timing is rounded up to whole cycles, the result can be used as the start of EXMC_SMC_TuneTiming().
+ */
+int32_t EXMC_SMC_CalcTiming(const stc_exmc_smc_timing_ns_t *pstcTimingNs, uint32_t u32ExclkFreq,
+                            stc_exmc_smc_timing_config_t *pstcTimingConfig)
+{
+    uint32_t u32RC;
+    uint32_t u32WC;
+    uint32_t u32CEOE;
+    uint32_t u32WP;
+    uint32_t u32TR;
+    uint32_t u32ADV;
+    const uint32_t u32ClockKhz = u32ExclkFreq / 1000UL;
+
+    if ((NULL == pstcTimingNs) || (NULL == pstcTimingConfig) || (0UL == u32ClockKhz)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    u32CEOE = EXMC_SMC_NsToCycle(pstcTimingNs->u32CeOeDelay, u32ClockKhz);
+    u32WP = LL_MAX(EXMC_SMC_NsToCycle(pstcTimingNs->u32WritePulse, u32ClockKhz), 1UL);
+    /* The cycle covers the strobe and at least one more cycle */
+    u32RC = LL_MAX(EXMC_SMC_NsToCycle(pstcTimingNs->u32ReadCycle, u32ClockKhz), u32CEOE + 1UL);
+    u32WC = LL_MAX(EXMC_SMC_NsToCycle(pstcTimingNs->u32WriteCycle, u32ClockKhz), u32WP + 1UL);
+    u32TR = EXMC_SMC_NsToCycle(pstcTimingNs->u32Turnaround, u32ClockKhz);
+    u32ADV = EXMC_SMC_NsToCycle(pstcTimingNs->u32AdvPulse, u32ClockKhz);
+    if ((!IS_EXMC_SMC_TIMING_RC_CYCLE(u32RC)) || (!IS_EXMC_SMC_TIMING_WC_CYCLE(u32WC)) ||
+        (!IS_EXMC_SMC_TIMING_CEOE_CYCLE(u32CEOE)) || (!IS_EXMC_SMC_TIMING_WP_CYCLE(u32WP)) ||
+        (!IS_EXMC_SMC_TIMING_TR_CYCLE(u32TR)) || (!IS_EXMC_SMC_TIMING_ADV_CYCLE(u32ADV))) {
+        return LL_ERR;
+    }
+
+    pstcTimingConfig->u8RC = (uint8_t)u32RC;
+    pstcTimingConfig->u8WC = (uint8_t)u32WC;
+    pstcTimingConfig->u8CEOE = (uint8_t)u32CEOE;
+    pstcTimingConfig->u8WP = (uint8_t)u32WP;
+    pstcTimingConfig->u8TR = (uint8_t)u32TR;
+    pstcTimingConfig->u8ADV = (uint8_t)u32ADV;
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Tighten the timing of a chip by memory tests.
+ * @param  [in] u32Chip                 The chip number.
+ *         This parameter can be one of the macros group @ref EXMC_SMC_Chip
+ * @param  [in] u32Addr                 Start address of the test area in the chip, word aligned.
+ * @param  [in] u32Size                 Size of the test area in bytes, a non-zero multiple of 4.
+ * @param  [in,out] pstcTimingConfig    Pointer to a @ref stc_exmc_smc_timing_config_t structure, the start timing
+ *                                      which must pass the test, the tuned timing is returned.
+ * @retval int32_t:
+ *           - LL_OK:                   The tuned timing is applied.
+ *           - LL_ERR:                  The start timing or the tuned timing fails the test.
+ *           - LL_ERR_INVD_PARAM:       Invalid parameter.
+ * @note   1)Each timing is lowered one cycle at a time while the test passes. A timing that fails is set back to
+ *           the last passing value plus EXMC_SMC_TUNE_MARGIN cycles.
+ *         2)Call EXMC_SMC_Init() first. The contents of the test area are destroyed, and the memory must not be
+ *           accessed by others while tuning. Tune at the highest temperature and lowest voltage of the product,
+ *           or keep a larger margin.
+ */
+int32_t EXMC_SMC_TuneTiming(uint32_t u32Chip, uint32_t u32Addr, uint32_t u32Size,
+                            stc_exmc_smc_timing_config_t *pstcTimingConfig)
+{
+    uint32_t i;
+    uint8_t u8Min;
+    uint8_t au8Fail[EXMC_SMC_TUNE_FIELD_NUM] = {0U};
+    uint8_t *apu8Field[EXMC_SMC_TUNE_FIELD_NUM];
+    const uint8_t au8Max[EXMC_SMC_TUNE_FIELD_NUM] = {7U, 7U, 0x0FU, 0x0FU, 7U, 7U};
+    const uint32_t u32Words = u32Size / 4UL;
+
+    if ((NULL == pstcTimingConfig) || (0UL == u32Words) || (0UL != (u32Size & 3UL)) ||
+        (!IS_ADDR_ALIGN_WORD(u32Addr)) || (!IS_EXMC_SMC_CHIP(u32Chip)) ||
+        (u32Addr < EXMC_SMC_GetChipStartAddr(u32Chip)) ||
+        ((EXMC_SMC_GetChipEndAddr(u32Chip) - u32Addr) < (u32Size - 1UL))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    apu8Field[EXMC_SMC_TUNE_CEOE] = &pstcTimingConfig->u8CEOE;
+    apu8Field[EXMC_SMC_TUNE_WP] = &pstcTimingConfig->u8WP;
+    apu8Field[EXMC_SMC_TUNE_RC] = &pstcTimingConfig->u8RC;
+    apu8Field[EXMC_SMC_TUNE_WC] = &pstcTimingConfig->u8WC;
+    apu8Field[EXMC_SMC_TUNE_TR] = &pstcTimingConfig->u8TR;
+    apu8Field[EXMC_SMC_TUNE_ADV] = &pstcTimingConfig->u8ADV;
+    for (i = 0UL; i < EXMC_SMC_TUNE_FIELD_NUM; i++) {
+        if (*apu8Field[i] > au8Max[i]) {
+            return LL_ERR_INVD_PARAM;
+        }
+    }
+
+    EXMC_SMC_SetTiming(u32Chip, pstcTimingConfig);
+    if (LL_OK != EXMC_SMC_MemTest(u32Addr, u32Words)) {
+        return LL_ERR;
+    }
+
+    for (i = 0UL; i < EXMC_SMC_TUNE_FIELD_NUM; i++) {
+        if (EXMC_SMC_TUNE_RC == i) {
+            u8Min = (uint8_t)(pstcTimingConfig->u8CEOE + 1U);
+        } else if (EXMC_SMC_TUNE_WC == i) {
+            u8Min = (uint8_t)(pstcTimingConfig->u8WP + 1U);
+        } else if (EXMC_SMC_TUNE_WP == i) {
+            u8Min = 1U;
+        } else {
+            u8Min = 0U;
+        }
+        while ((0U == au8Fail[i]) && (*apu8Field[i] > u8Min)) {
+            (*apu8Field[i])--;
+            EXMC_SMC_SetTiming(u32Chip, pstcTimingConfig);
+            if (LL_OK != EXMC_SMC_MemTest(u32Addr, u32Words)) {
+                (*apu8Field[i])++;
+                au8Fail[i] = 1U;
+            }
+        }
+    }
+
+    /* Back off from the edge */
+    for (i = 0UL; i < EXMC_SMC_TUNE_FIELD_NUM; i++) {
+        if (0U != au8Fail[i]) {
+            *apu8Field[i] = (uint8_t)LL_MIN((uint32_t)*apu8Field[i] + EXMC_SMC_TUNE_MARGIN, (uint32_t)au8Max[i]);
+        }
+    }
+    /* The strobe grown by the margin must stay shorter than the cycle */
+    pstcTimingConfig->u8RC = (uint8_t)LL_MAX(pstcTimingConfig->u8RC, pstcTimingConfig->u8CEOE + 1U);
+    pstcTimingConfig->u8WC = (uint8_t)LL_MAX(pstcTimingConfig->u8WC, pstcTimingConfig->u8WP + 1U);
+
+    EXMC_SMC_SetTiming(u32Chip, pstcTimingConfig);
+
+    return EXMC_SMC_MemTest(u32Addr, u32Words);
+}
+
 /**
  * @}
  */
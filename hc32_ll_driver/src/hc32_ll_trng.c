@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2024-09-13       CDT             First version
+   2026-10-18       CDT             Add entropy pool refilled by TRNG end interrupt
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2025, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -69,6 +70,8 @@
 
 /* TRNG reset timeout */
 #define TRNG_RMU_TIMEOUT                    (100UL)
+
+#define IS_TRNG_POOL_SIZE(x)                (((x) >= 2UL) && (((x) & ((x) - 1UL)) == 0UL))
 /**
  * @}
  */
@@ -239,6 +242,133 @@ int32_t TRNG_GetRandom(uint32_t *pu32Random, uint8_t u8RandomLen)
     return i32Ret;
 }
 
+/**
+ * @brief  Initializes a TRNG entropy pool and starts filling it.
+ * @param  [out] pstcPool               Pointer to a @ref stc_trng_pool_t structure.
+ * @param  [in]  pu32Buf                Pointer to the ring buffer of the pool.
+ * @param  [in]  u32Size                Size(in word) of the ring buffer, must be a power of 2 and not less than 2.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcPool == NULL or pu32Buf == NULL or u32Size is invalid.
+ * @note 1. TRNG must be initialized and enabled by TRNG_Init() and TRNG_Cmd() before calling this function.
+ * @note 2. The interrupt INT_SRC_TRNG_END must be registered, and TRNG_PoolIrqHandler() must be
+ *          called in its interrupt service routine.
+ */
+int32_t TRNG_PoolInit(stc_trng_pool_t *pstcPool, uint32_t *pu32Buf, uint32_t u32Size)
+{
+    if ((pstcPool == NULL) || (pu32Buf == NULL) || (!IS_TRNG_POOL_SIZE(u32Size))) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    pstcPool->pu32Buf     = pu32Buf;
+    pstcPool->u32Size     = u32Size;
+    pstcPool->u32WriteIdx = 0UL;
+    pstcPool->u32ReadIdx  = 0UL;
+    pstcPool->u32Running  = 1UL;
+    /* Start the first generating, the rest is driven by TRNG_PoolIrqHandler() */
+    WRITE_REG32(bCM_TRNG->CR_b.RUN, 1U);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Moves the generated random number into the pool and starts the next generating.
+ * @param  [in]  pstcPool               Pointer to a @ref stc_trng_pool_t structure.
+ * @retval None
+ * @note Call it in the interrupt service routine of INT_SRC_TRNG_END. It can also be called
+ *       periodically, e.g. from a timer interrupt, it does nothing if TRNG is still running.
+ *       TRNG stops when the pool is full and is restarted by TRNG_PoolRead().
+ */
+void TRNG_PoolIrqHandler(stc_trng_pool_t *pstcPool)
+{
+    uint32_t u32WriteIdx;
+    uint32_t u32Free;
+
+    if ((pstcPool == NULL) || (pstcPool->u32Running == 0UL) || (READ_REG32(bCM_TRNG->CR_b.RUN) != 0U)) {
+        return;
+    }
+
+    u32WriteIdx = pstcPool->u32WriteIdx;
+    u32Free = pstcPool->u32Size - (u32WriteIdx - pstcPool->u32ReadIdx);
+    if (u32Free > 0UL) {
+        pstcPool->pu32Buf[u32WriteIdx & (pstcPool->u32Size - 1UL)] = READ_REG32(CM_TRNG->DR0);
+        u32WriteIdx++;
+        u32Free--;
+    }
+    if (u32Free > 0UL) {
+        pstcPool->pu32Buf[u32WriteIdx & (pstcPool->u32Size - 1UL)] = READ_REG32(CM_TRNG->DR1);
+        u32WriteIdx++;
+        u32Free--;
+    }
+    /* Publish the new words after they are stored */
+    pstcPool->u32WriteIdx = u32WriteIdx;
+
+    if (u32Free > 0UL) {
+        WRITE_REG32(bCM_TRNG->CR_b.RUN, 1U);
+    } else {
+        pstcPool->u32Running = 0UL;
+    }
+}
+
+/**
+ * @brief  Reads random number from the TRNG entropy pool without waiting.
+ * @param  [in]  pstcPool               Pointer to a @ref stc_trng_pool_t structure.
+ * @param  [out] pu32Random             The destination buffer to store the random number.
+ * @param  [in]  u32RandomLen           The size(in word) of the destination buffer.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcPool == NULL or pu32Random == NULL or u32RandomLen == 0
+ *           - LL_ERR_BUF_EMPTY:        The pool does not hold u32RandomLen words yet, nothing is read.
+ * @note Only one reader is supported, the caller must serialize the calls if there are more readers.
+ *       Each word is handed out only once.
+ */
+int32_t TRNG_PoolRead(stc_trng_pool_t *pstcPool, uint32_t *pu32Random, uint32_t u32RandomLen)
+{
+    uint32_t i;
+    uint32_t u32ReadIdx;
+
+    if ((pstcPool == NULL) || (pu32Random == NULL) || (u32RandomLen == 0UL)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    if ((pstcPool->u32WriteIdx - pstcPool->u32ReadIdx) < u32RandomLen) {
+        return LL_ERR_BUF_EMPTY;
+    }
+
+    u32ReadIdx = pstcPool->u32ReadIdx;
+    for (i = 0UL; i < u32RandomLen; i++) {
+        pu32Random[i] = pstcPool->pu32Buf[u32ReadIdx & (pstcPool->u32Size - 1UL)];
+        /* Do not leave the used random number in the pool */
+        pstcPool->pu32Buf[u32ReadIdx & (pstcPool->u32Size - 1UL)] = 0UL;
+        u32ReadIdx++;
+    }
+    pstcPool->u32ReadIdx = u32ReadIdx;
+
+    /* Refill. TRNG_PoolIrqHandler() does not run while the generating is stopped. */
+    if (pstcPool->u32Running == 0UL) {
+        pstcPool->u32Running = 1UL;
+        WRITE_REG32(bCM_TRNG->CR_b.RUN, 1U);
+    }
+
+    return LL_OK;
+}
+
+/**
+ * @brief  Get the number of random words available in the TRNG entropy pool.
+ * @param  [in]  pstcPool               Pointer to a @ref stc_trng_pool_t structure.
+ * @retval An uint32_t value of the number of random words.
+ */
+uint32_t TRNG_PoolGetCount(const stc_trng_pool_t *pstcPool)
+{
+    uint32_t u32Count = 0UL;
+
+    if (pstcPool != NULL) {
+        u32Count = pstcPool->u32WriteIdx - pstcPool->u32ReadIdx;
+    }
+
+    return u32Count;
+}
+
 /**
  * @}
  */